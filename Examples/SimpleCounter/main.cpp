@@ -11,7 +11,7 @@
 #include <chrono>
 
 #include "SpinTimer.h"
-#include "MySpinTimerAction.hpp"
+#include "SpinTimerCallback.h"
 
 int main(void)
 {
@@ -23,9 +23,9 @@ int main(void)
     uint32_t count2 = 0;
     uint32_t count3 = 0;
 
-    SpinTimer spinTimer1sec(spinTimer_1s_millis, new MySpinTimerAction([&count1]() { count1++; }), SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
-    SpinTimer spinTimer2sec(spinTimer_2s_millis, new MySpinTimerAction([&count2]() { count2++; }), SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
-    SpinTimer spinTimer5sec(spinTimer_5s_millis, new MySpinTimerAction([&count3]() { count3++; }), SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+    SpinTimerCallback spinTimer1sec(spinTimer_1s_millis, [&count1]() { count1++; }, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+    SpinTimerCallback spinTimer2sec(spinTimer_2s_millis, [&count2]() { count2++; }, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+    SpinTimerCallback spinTimer5sec(spinTimer_5s_millis, [&count3]() { count3++; }, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
 
     // Forever Loop
     for (;;)
@@ -0,0 +1,50 @@
+/*
+ * MonotonicUptimeInfoAdapter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "MonotonicUptimeInfoAdapter.h"
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+
+inline unsigned long long MonotonicUptimeInfoAdapter::nanos() const
+{
+  struct timespec tp;
+  clock_gettime(m_clockId, &tp);
+  return static_cast<unsigned long long>(tp.tv_sec) * 1000000000ULL + tp.tv_nsec;
+}
+
+MonotonicUptimeInfoAdapter::MonotonicUptimeInfoAdapter(Clock clock)
+#ifdef CLOCK_MONOTONIC_COARSE
+: m_clockId((COARSE == clock) ? CLOCK_MONOTONIC_COARSE : CLOCK_MONOTONIC)
+#else
+: m_clockId(CLOCK_MONOTONIC)
+#endif
+, m_originNanos(nanos())
+{
+  (void)clock;
+}
+
+MonotonicUptimeInfoAdapter::~MonotonicUptimeInfoAdapter()
+{ }
+
+unsigned long MonotonicUptimeInfoAdapter::tMillis()
+{
+  return static_cast<unsigned long>((nanos() - m_originNanos) / 1000000ULL);
+}
+
+SpinTimerTick MonotonicUptimeInfoAdapter::tTicks()
+{
+  return static_cast<SpinTimerTick>((nanos() - m_originNanos) / (1000000ULL / SPINTIMER_TICKS_PER_MILLI));
+}
+
+unsigned long long MonotonicUptimeInfoAdapter::resolutionNanos() const
+{
+  struct timespec res;
+  clock_getres(m_clockId, &res);
+  return static_cast<unsigned long long>(res.tv_sec) * 1000000000ULL + res.tv_nsec;
+}
+
+#endif
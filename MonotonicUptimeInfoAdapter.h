@@ -0,0 +1,83 @@
+/*
+ * MonotonicUptimeInfoAdapter.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef MONOTONICUPTIMEINFOADAPTER_H_
+#define MONOTONICUPTIMEINFOADAPTER_H_
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+
+#include <time.h>
+#include "UptimeInfo.h"
+
+/**
+ * POSIX monotonic clock UptimeInfoAdapter implementation.
+ *
+ * Features:
+ * - based on clock_gettime(CLOCK_MONOTONIC), not affected by system time changes
+ * - optionally based on the coarse monotonic clock (Linux: CLOCK_MONOTONIC_COARSE), which is read from the vDSO data
+ *   page without even reading the hardware counter, i.e. a few nanoseconds per call; its resolution is the kernel's
+ *   tick period (typically 1 .. 4 ms), so it suits the millisecond time base (@see SpinTimerTick.h)
+ * - time is related to the creation of the adapter object, so it starts near zero
+ * - provides the up-time in the configured time base resolution (@see SpinTimerTick.h) with tTicks(),
+ *   used as default adapter on POSIX systems (the coarse clock if SPINTIMER_UPTIME_COARSE is defined)
+ *
+ * Integration:
+ *
+ *       UptimeInfo::Instance()->setAdapter(new MonotonicUptimeInfoAdapter(MonotonicUptimeInfoAdapter::COARSE));
+ */
+class MonotonicUptimeInfoAdapter : public UptimeInfoAdapter
+{
+public:
+  /**
+   * Monotonic clock to be read.
+   */
+  enum Clock
+  {
+    PRECISE,  /// CLOCK_MONOTONIC (default).
+    COARSE    /// CLOCK_MONOTONIC_COARSE, CLOCK_MONOTONIC where not available.
+  };
+
+  /**
+   * Constructor, takes the current monotonic clock time as origin.
+   * @param clock Monotonic clock to be read, default: PRECISE.
+   */
+  MonotonicUptimeInfoAdapter(Clock clock = PRECISE);
+
+  /**
+   * Destructor.
+   */
+  virtual ~MonotonicUptimeInfoAdapter();
+
+  // UptimeInfoAdapter interface
+  unsigned long tMillis();
+  SpinTimerTick tTicks();
+
+  /**
+   * Resolution of the clock being read, as reported by clock_getres().
+   * @return Resolution [ns].
+   */
+  unsigned long long resolutionNanos() const;
+
+private:
+  /**
+   * Read the monotonic clock.
+   * @return Time since an unspecified point in the past [ns].
+   */
+  inline unsigned long long nanos() const;
+
+private:
+  clockid_t m_clockId;               /// Clock being read.
+  unsigned long long m_originNanos;  /// Monotonic clock time of the adapter's creation [ns].
+
+private: // forbidden functions
+  MonotonicUptimeInfoAdapter(const MonotonicUptimeInfoAdapter& src);              // copy constructor
+  MonotonicUptimeInfoAdapter& operator = (const MonotonicUptimeInfoAdapter& src); // assignment operator
+};
+
+#endif
+
+#endif /* MONOTONICUPTIMEINFOADAPTER_H_ */
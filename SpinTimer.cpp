@@ -10,6 +10,26 @@
 #include <limits.h>
 #include "UptimeInfo.h"
 #include "SpinTimerContext.h"
+#include "SpinTimerGroup.h"
+#include "SpinTimerTrace.h"
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+#include <time.h>
+#define SPINTIMER_SLEEPING_DELAY
+
+/**
+ * Suspend the calling thread.
+ * @param timeTicks Time to sleep [ticks].
+ */
+static void sleepTicks(SpinTimerTick timeTicks)
+{
+  const SpinTimerTick ticksPerSecond = SPINTIMER_TICKS_PER_MILLI * 1000;
+  struct timespec request;
+  request.tv_sec  = timeTicks / ticksPerSecond;
+  request.tv_nsec = (timeTicks % ticksPerSecond) * (1000000 / SPINTIMER_TICKS_PER_MILLI);
+  nanosleep(&request, 0);
+}
+#endif
 
 const bool SpinTimer::IS_NON_RECURRING = false;
 const bool SpinTimer::IS_RECURRING     = true;
@@ -18,7 +38,30 @@ const bool SpinTimer::IS_AUTOSTART     = true;
 
 void scheduleTimers()
 {
-  SpinTimerContext::instance()->handleTick();
+  SpinTimerContext::current()->handleTick();
+}
+
+void scheduleTimersAndSleep(void (*sleep)(SpinTimerTick sleepTicks))
+{
+  SpinTimerContext* context = SpinTimerContext::current();
+  context->handleTick();
+
+  SpinTimerTick sleepTimeTicks = context->nextExpiryTicks();
+  if ((0 == sleepTimeTicks) || (SpinTimerContext::NO_EXPIRY_TICKS == sleepTimeTicks))
+  {
+    // a timer is due already, or no timer is running (a timer may get started by an interrupt or another thread)
+    return;
+  }
+  if (0 != sleep)
+  {
+    sleep(sleepTimeTicks);
+  }
+#ifdef SPINTIMER_SLEEPING_DELAY
+  else
+  {
+    sleepTicks(sleepTimeTicks);
+  }
+#endif
 }
 
 void delayAndSchedule(unsigned long delayMillis)
@@ -31,22 +74,79 @@ void delayAndSchedule(unsigned long delayMillis)
   {
     // schedule the timer above and all the other timers, so they will still run in 'parallel'
     scheduleTimers();
+
+#ifdef SPINTIMER_SLEEPING_DELAY
+    if (delayTimer.isRunning())
+    {
+      // sleep until the next timer (at the latest the timer above) expires
+      SpinTimerTick sleepTimeTicks = SpinTimerContext::current()->nextExpiryTicks();
+      if (0 != sleepTimeTicks)
+      {
+        sleepTicks(sleepTimeTicks);
+      }
+    }
+#endif
   }
 }
 
-SpinTimer::SpinTimer(unsigned long timeMillis, SpinTimerAction* action, bool isRecurring, bool isAutostart)
-: m_isRunning(false)
-, m_isRecurring(isRecurring)
-, m_isExpiredFlag(false)
-, m_willOverflow(false)
-, m_currentTimeMillis(0)
-, m_triggerTimeMillis(0)
-, m_triggerTimeMillisUpperLimit(ULONG_MAX)
-, m_delayMillis(timeMillis)
+SpinTimer::SpinTimer(unsigned long timeMillis, SpinTimerAction* action, bool isRecurring, bool isAutostart, SpinTimerContext* context, unsigned long slackMillis)
+: m_currentTimeTicks(0)
+, m_triggerTimeTicks(0)
+, m_delayTicks(static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI)
+, m_slackTicks(static_cast<SpinTimerTick>(slackMillis) * SPINTIMER_TICKS_PER_MILLI)
+, m_alignTicks(0)
+, m_overrunCount(0)
 , m_action(action)
+, m_context((0 != context) ? context : SpinTimerContext::current())
 , m_next(0)
+, m_prev(0)
+, m_engineNext(0)
+, m_enginePrev(0)
+, m_engineChild(0)
+, m_engineTag(0)
+, m_isRunning(false)
+, m_isRecurring(isRecurring)
+, m_recurringPolicy(FIXED_DELAY)
+#ifdef SPINTIMER_BUDGET
+, m_isPending(false)
+#endif
+#ifdef SPINTIMER_LAZY_RESTART
+, m_isRearmPending(false)
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+, m_isDispatcherBypassed(false)
+#endif
+, m_isCallback(false)
+, m_isExpiredFlag(false)
+#ifdef SPINTIMER_LAZY_RESTART
+, m_rearmTicks(0)
+#endif
+#ifdef SPINTIMER_BUDGET
+, m_pendingNext(0)
+, m_pendingDeadlineTicks(0)
+, m_pendingOverruns(0)
+#endif
+#ifdef SPINTIMER_GROUPS
+, m_group(0)
+, m_groupNext(0)
+, m_groupPrev(0)
+, m_groupGeneration(0)
+, m_groupShiftTicks(0)
+, m_isParked(false)
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+, m_isCommandQueued(false)
+, m_command(CMD_NONE)
+, m_commandNext(0)
+, m_dispatchCount(0)
+, m_dispatchOverruns(0)
+, m_dispatchNext(0)
+#ifdef SPINTIMER_STATISTICS
+, m_dispatchDeadlineTicks(0)
+#endif
+#endif
 {
-  SpinTimerContext::instance()->attach(this);
+  m_context->attach(this);
 
   if(isAutostart)
   {
@@ -56,18 +156,69 @@ SpinTimer::SpinTimer(unsigned long timeMillis, SpinTimerAction* action, bool isR
 
 SpinTimer::~SpinTimer()
 {
-  SpinTimerContext::instance()->detach(this);
+#ifdef SPINTIMER_GROUPS
+  if (0 != m_group)
+  {
+    m_group->unlink(this);
+  }
+#endif
+  m_context->detach(this);
 }
 
 void SpinTimer::attachAction(SpinTimerAction* action)
 {
+  m_isCallback = false;
   m_action = action;
 }
 
 SpinTimerAction* SpinTimer::action() const
 {
-  return m_action;
+  return m_isCallback ? 0 : m_action;
+}
+
+void SpinTimer::attachCallback(Callback callback)
+{
+  m_isCallback = true;
+  m_callback = callback;
+}
+
+void SpinTimer::bypassDispatcher()
+{
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  m_isDispatcherBypassed = true;
+#endif
+}
+
+void SpinTimer::quiesce()
+{
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  m_context->quiesce(this);
+#endif
+}
+
+SpinTimerContext* SpinTimer::context() const
+{
+  return m_context;
+}
+
+#ifdef SPINTIMER_GROUPS
+SpinTimerGroup* SpinTimer::group() const
+{
+  return m_group;
+}
+#endif
+
+#ifdef SPINTIMER_STATISTICS
+const SpinTimerStatistics& SpinTimer::statistics() const
+{
+  return m_statistics;
+}
+
+void SpinTimer::resetStatistics()
+{
+  m_statistics.reset();
 }
+#endif
 
 SpinTimer* SpinTimer::next() const
 {
@@ -79,23 +230,74 @@ void SpinTimer::setNext(SpinTimer* timer)
   m_next = timer;
 }
 
+SpinTimer* SpinTimer::prev() const
+{
+  return m_prev;
+}
+
+void SpinTimer::setPrev(SpinTimer* timer)
+{
+  m_prev = timer;
+}
+
 
 bool SpinTimer::isExpired()
 {
-  internalTick();
-  bool isExpired = m_isExpiredFlag;
-  m_isExpiredFlag = false;
-  return isExpired;
+  internalTick(UptimeInfo::Instance()->tTicks());
+  return fetchExpiredFlag();
+}
+
+bool SpinTimer::isCancelledByGroup() const
+{
+#ifdef SPINTIMER_GROUPS
+  return (0 != m_group) && (m_groupGeneration != m_group->m_generation);
+#else
+  return false;
+#endif
+}
+
+bool SpinTimer::isParked() const
+{
+#ifdef SPINTIMER_GROUPS
+  return m_isParked;
+#else
+  return false;
+#endif
 }
 
 bool SpinTimer::isRunning() const
 {
-  return m_isRunning;
+  return m_isRunning && !isCancelledByGroup();
 }
 
 unsigned long SpinTimer::getInterval() const
 {
-  return m_delayMillis;
+  return static_cast<unsigned long>(m_delayTicks / SPINTIMER_TICKS_PER_MILLI);
+}
+
+SpinTimerTick SpinTimer::getIntervalTicks() const
+{
+  return m_delayTicks;
+}
+
+void SpinTimer::setSlack(unsigned long slackMillis)
+{
+  m_slackTicks = static_cast<SpinTimerTick>(slackMillis) * SPINTIMER_TICKS_PER_MILLI;
+}
+
+void SpinTimer::setSlackTicks(SpinTimerTick slackTicks)
+{
+  m_slackTicks = slackTicks;
+}
+
+unsigned long SpinTimer::getSlack() const
+{
+  return static_cast<unsigned long>(m_slackTicks / SPINTIMER_TICKS_PER_MILLI);
+}
+
+SpinTimerTick SpinTimer::getSlackTicks() const
+{
+  return m_slackTicks;
 }
 
 void SpinTimer::setIsRecurring(bool isRecurring) 
@@ -103,85 +305,404 @@ void SpinTimer::setIsRecurring(bool isRecurring)
   m_isRecurring = isRecurring;
 }
 
+void SpinTimer::setRecurringPolicy(RecurringPolicy policy)
+{
+  m_recurringPolicy = static_cast<unsigned char>(policy);
+}
+
+SpinTimer::RecurringPolicy SpinTimer::recurringPolicy() const
+{
+  return static_cast<RecurringPolicy>(m_recurringPolicy);
+}
+
+unsigned long SpinTimer::getOverrunCount() const
+{
+  return m_overrunCount;
+}
+
 void SpinTimer::tick()
 {
-  internalTick();
+  internalTick(UptimeInfo::Instance()->tTicks());
+}
+
+void SpinTimer::tick(SpinTimerTick currentTimeTicks)
+{
+  internalTick(currentTimeTicks);
 }
 
 void SpinTimer::cancel()
 {
+#ifdef SPINTIMER_TRACE
+  SpinTimerTrace::emit(SpinTimerTrace::EVENT_CANCEL, this, UptimeInfo::Instance()->tTicks(), 0);
+#endif
   m_isRunning = false;
-  m_isExpiredFlag = false;
+#ifdef SPINTIMER_LAZY_RESTART
+  m_isRearmPending = false;
+#endif
+#ifdef SPINTIMER_GROUPS
+  m_isParked = false;
+#endif
+  setExpiredFlag(false);
+  m_context->unschedule(this);
+#ifdef SPINTIMER_BUDGET
+  if (m_isPending)
+  {
+    m_context->removePending(this);
+  }
+#endif
 }
 
 void SpinTimer::start(unsigned long timeMillis)
 {
-  m_isRunning = true;
-  m_delayMillis = timeMillis;
-  m_currentTimeMillis = UptimeInfo::Instance()->tMillis();
-  startInterval();
+  startTicks(static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI);
+}
+
+void SpinTimer::start(unsigned long timeMillis, unsigned long slackMillis)
+{
+  m_slackTicks = static_cast<SpinTimerTick>(slackMillis) * SPINTIMER_TICKS_PER_MILLI;
+  start(timeMillis);
+}
+
+void SpinTimer::startTicks(SpinTimerTick timeTicks)
+{
+  m_delayTicks = timeTicks;
+  startAt(UptimeInfo::Instance()->tTicks());
 }
 
 void SpinTimer::start()
+{
+  startAt(UptimeInfo::Instance()->tTicks());
+}
+
+void SpinTimer::restart()
+{
+  restart(UptimeInfo::Instance()->tTicks());
+}
+
+void SpinTimer::restart(SpinTimerTick currentTimeTicks)
+{
+#ifdef SPINTIMER_LAZY_RESTART
+  // the new deadline must not be earlier than the one the engine keeps, i.e. the restart must not be earlier than
+  // the start of the running interval (signed difference, overflow safe); a group member must be up to date with its
+  // group's state
+  SpinTimerTick intervalStartTicks = m_triggerTimeTicks - m_delayTicks - m_alignTicks;
+  bool isEager = !m_isRunning || (static_cast<SpinTimerTickDiff>(currentTimeTicks - intervalStartTicks) < 0);
+#ifdef SPINTIMER_GROUPS
+  isEager = isEager || ((0 != m_group) && !m_group->isSynced(this));
+#endif
+  if (isEager)
+  {
+    startAt(currentTimeTicks);
+    return;
+  }
+
+  // lazy re-arming, the timer gets moved when its previous deadline comes up (@see expire())
+  m_rearmTicks = currentTimeTicks;
+  m_isRearmPending = true;
+  m_overrunCount = 0;
+#ifdef SPINTIMER_TRACE
+  SpinTimerTrace::emit(SpinTimerTrace::EVENT_START, this, currentTimeTicks, m_delayTicks);
+#endif
+#else
+  startAt(currentTimeTicks);
+#endif
+}
+
+void SpinTimer::startAt(SpinTimerTick currentTimeTicks)
 {
   m_isRunning = true;
-  m_currentTimeMillis = UptimeInfo::Instance()->tMillis();
+#ifdef SPINTIMER_LAZY_RESTART
+  m_isRearmPending = false;
+#endif
+  m_overrunCount = 0;
+  m_currentTimeTicks = currentTimeTicks;
+#ifdef SPINTIMER_GROUPS
+  if (0 != m_group)
+  {
+    m_group->sync(this, currentTimeTicks);
+  }
+#endif
   startInterval();
+  m_context->schedule(this);
+#ifdef SPINTIMER_TRACE
+  SpinTimerTrace::emit(SpinTimerTrace::EVENT_START, this, m_currentTimeTicks, m_delayTicks);
+#endif
 }
 
-void SpinTimer::startInterval()
+void SpinTimer::startFixedRateInterval()
 {
-  unsigned long deltaTime = ULONG_MAX - m_currentTimeMillis;
-  m_willOverflow = (deltaTime < m_delayMillis);
-  if (m_willOverflow)
+  SpinTimerTick nowTicks = m_currentTimeTicks;
+  SpinTimerTick deadlineTicks = m_triggerTimeTicks - m_alignTicks;  // exact deadline, the period grid is kept
+
+  // deadline has passed, the difference is overflow safe
+  SpinTimerTick missedPeriods = (0 != m_delayTicks) ? (nowTicks - deadlineTicks) / m_delayTicks : 0;
+  m_overrunCount = (missedPeriods > ULONG_MAX) ? ULONG_MAX : static_cast<unsigned long>(missedPeriods);
+
+  if (FIXED_RATE_SKIP == m_recurringPolicy)
   {
-    // overflow will occur
-    m_triggerTimeMillis = m_delayMillis - deltaTime - 1;
-    m_triggerTimeMillisUpperLimit = m_currentTimeMillis;
+    // continue with the latest passed deadline
+    deadlineTicks += missedPeriods * m_delayTicks;
   }
-  else
+
+  // the next interval starts at the deadline, the trigger time stays on the grid of the period
+  m_currentTimeTicks = deadlineTicks;
+  startInterval();
+  m_currentTimeTicks = nowTicks;
+}
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+const unsigned int SpinTimer::CMD_NONE;
+const unsigned int SpinTimer::CMD_START;
+const unsigned int SpinTimer::CMD_START_INTERVAL;
+const unsigned int SpinTimer::CMD_CANCEL;
+const unsigned int SpinTimer::CMD_BITS;
+
+void SpinTimer::postStart(unsigned long timeMillis)
+{
+  postCommand(CMD_START_INTERVAL, static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI);
+}
+
+void SpinTimer::postStart()
+{
+  postCommand(CMD_START, 0);
+}
+
+void SpinTimer::postCancel()
+{
+  postCommand(CMD_CANCEL, 0);
+}
+
+bool SpinTimer::fetchExpired()
+{
+  return fetchExpiredFlag();
+}
+
+void SpinTimer::postCommand(unsigned int command, SpinTimerTick delayTicks)
+{
+  const unsigned long long maxDelayTicks = ~0ULL >> CMD_BITS;
+  unsigned long long commandDelayTicks = (delayTicks > maxDelayTicks) ? maxDelayTicks : delayTicks;
+  m_command.store((commandDelayTicks << CMD_BITS) | command, std::memory_order_release);
+  if (!m_isCommandQueued.exchange(true, std::memory_order_acq_rel))
+  {
+    m_context->post(this);
+  }
+}
+
+void SpinTimer::applyCommand()
+{
+  // clear the queued flag before taking the command, a command posted in between queues the timer again
+  m_isCommandQueued.store(false, std::memory_order_seq_cst);
+  unsigned long long command = m_command.exchange(CMD_NONE, std::memory_order_acq_rel);
+  switch (command & ((1U << CMD_BITS) - 1))
   {
-    m_triggerTimeMillis = m_currentTimeMillis + m_delayMillis;
-    m_triggerTimeMillisUpperLimit = ULONG_MAX - deltaTime;
+    case CMD_START:
+      start();
+      break;
+    case CMD_START_INTERVAL:
+      startTicks(static_cast<SpinTimerTick>(command >> CMD_BITS));
+      break;
+    case CMD_CANCEL:
+      cancel();
+      break;
+    default:
+      break;
   }
 }
 
-void SpinTimer::internalTick()
+void SpinTimer::runDispatched()
 {
-  bool intervalIsOver = false;
+  do
+  {
+#ifdef SPINTIMER_STATISTICS
+    SpinTimerTick deadlineTicks = m_dispatchDeadlineTicks.load(std::memory_order_relaxed);
+#else
+    SpinTimerTick deadlineTicks = 0;
+#endif
+    notifyAction(m_dispatchOverruns.exchange(0, std::memory_order_relaxed), deadlineTicks);
+  }
+  while (1 != m_dispatchCount.fetch_sub(1, std::memory_order_acq_rel));
+}
+#endif
 
-  m_currentTimeMillis = UptimeInfo::Instance()->tMillis();
+void SpinTimer::startInterval()
+{
+  // the deadline may wrap around, the interval start is kept implicitly as m_triggerTimeTicks - m_delayTicks - m_alignTicks
+  SpinTimerTick deadlineTicks = m_currentTimeTicks + m_delayTicks;
+  m_triggerTimeTicks = (0 != m_slackTicks) ? SpinTimerContext::coalesce(deadlineTicks, m_slackTicks) : deadlineTicks;
+  m_alignTicks = m_triggerTimeTicks - deadlineTicks;
+}
+
+SpinTimerTick SpinTimer::remainingTicks(SpinTimerTick currentTimeTicks) const
+{
+#if SPINTIMER_TICK_WRAPAROUND
+  SpinTimerTick windowTicks = m_delayTicks + m_alignTicks;
+  SpinTimerTick startTimeTicks = m_triggerTimeTicks - windowTicks;
+  SpinTimerTick elapsedTicks = currentTimeTicks - startTimeTicks;
+  if (static_cast<SpinTimerTickDiff>(elapsedTicks) >= 0)
+  {
+    // interval started before currentTimeTicks
+    return (elapsedTicks >= windowTicks) ? 0 : windowTicks - elapsedTicks;
+  }
+
+  // interval starts after currentTimeTicks
+  SpinTimerTick aheadTicks = startTimeTicks - currentTimeTicks;
+  return (windowTicks > SPINTIMER_TICK_MAX - aheadTicks) ? SPINTIMER_TICK_MAX : aheadTicks + windowTicks;
+#else
+  return (m_triggerTimeTicks > currentTimeTicks) ? m_triggerTimeTicks - currentTimeTicks : 0;
+#endif
+}
+
+bool SpinTimer::isIntervalOver() const
+{
+#if SPINTIMER_TICK_WRAPAROUND
+  // the interval is over as soon as the time elapsed since its start reaches the interval time (including the
+  // coalescing delay); the unsigned difference is overflow safe, a single compare covers the deadline wrapping around
+  // the time base range
+  SpinTimerTick windowTicks = m_delayTicks + m_alignTicks;
+  return (m_currentTimeTicks - (m_triggerTimeTicks - windowTicks)) >= windowTicks;
+#else
+  // 64 bit time base, will not overflow
+  return (m_triggerTimeTicks <= m_currentTimeTicks);
+#endif
+}
+
+void SpinTimer::internalTick(SpinTimerTick currentTimeTicks)
+{
+  m_currentTimeTicks = currentTimeTicks;
 
   // check if interval is over as long as the timer shall be running
-  if (m_isRunning)
+  if (m_isRunning & isIntervalOver())
+  {
+    expire();
+  }
+}
+
+void SpinTimer::expire()
+{
+#ifdef SPINTIMER_GROUPS
+  if ((0 != m_group) && m_group->intercept(this))
+  {
+    // cancelled, paused or shifted by the group
+    return;
+  }
+#endif
+
+#ifdef SPINTIMER_LAZY_RESTART
+  if (m_isRearmPending)
+  {
+    // the previous deadline of a lazily restarted timer has come up, start the interval from the restart time
+    m_isRearmPending = false;
+    SpinTimerTick nowTicks = m_currentTimeTicks;
+    m_currentTimeTicks = m_rearmTicks;
+    startInterval();
+    m_currentTimeTicks = nowTicks;
+    if (!isIntervalOver())
+    {
+      // move the timer to its new deadline
+      m_context->schedule(this);
+      return;
+    }
+  }
+#endif
+
+#ifdef SPINTIMER_STATISTICS
+  m_context->m_visitedCount++;
+#endif
+  SpinTimerTick deadlineTicks = m_triggerTimeTicks;
+
+  // interval is over
+  if (m_isRecurring)
   {
-    if (m_willOverflow)
+    // start next interval
+    if (FIXED_DELAY == m_recurringPolicy)
     {
-      intervalIsOver = ((m_triggerTimeMillis <= m_currentTimeMillis) && (m_currentTimeMillis < m_triggerTimeMillisUpperLimit));
+      startInterval();
     }
     else
     {
-      intervalIsOver = ((m_triggerTimeMillis <= m_currentTimeMillis) || (m_currentTimeMillis < m_triggerTimeMillisUpperLimit));
+      startFixedRateInterval();
     }
-    
-    if (intervalIsOver)
+    m_context->schedule(this);
+  }
+  else
+  {
+    m_isRunning = false;
+    m_context->unschedule(this);
+  }
+
+  setExpiredFlag(true);
+#ifdef SPINTIMER_TRACE
+  SpinTimerTrace::emit(SpinTimerTrace::EVENT_EXPIRE, this, m_currentTimeTicks, m_overrunCount);
+#endif
+  if (m_isCallback || (0 != m_action))
+  {
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+    if (!m_isDispatcherBypassed && (0 != m_context->dispatcher()))
     {
-      // interval is over
-      if (m_isRecurring)
+      if (0 != m_overrunCount)
       {
-        // start next interval
-        startInterval();
+        m_dispatchOverruns.fetch_add(m_overrunCount, std::memory_order_relaxed);
       }
-      else
+#ifdef SPINTIMER_STATISTICS
+      m_dispatchDeadlineTicks.store(deadlineTicks, std::memory_order_relaxed);
+#endif
+      if (0 == m_dispatchCount.fetch_add(1, std::memory_order_acq_rel))
       {
-        m_isRunning = false;
+        // not handed over yet, otherwise the running runDispatched() call will take care
+        m_context->dispatch(this);
       }
+      return;
+    }
+#endif
+#ifdef SPINTIMER_BUDGET
+    if (m_context->m_isDeferring)
+    {
+      // budgeted handleTick() call, the context runs the notification
+      m_context->defer(this, deadlineTicks, m_overrunCount);
+      return;
+    }
+#endif
+    notifyAction(m_overrunCount, deadlineTicks);
+  }
+#ifdef SPINTIMER_STATISTICS
+  else
+  {
+    // nothing to be notified, the expiration counts at its detection
+    recordExpiration(m_currentTimeTicks, deadlineTicks);
+  }
+#endif
+}
 
-      m_isExpiredFlag = true;
-      if (0 != m_action)
-      {
-        m_action->timeExpired();
-      }
+void SpinTimer::notifyAction(unsigned long overrunCount, SpinTimerTick deadlineTicks)
+{
+#ifdef SPINTIMER_STATISTICS
+  // lateness of the notification, later than the detection if handed over to the dispatcher or deferred by a budget
+  SpinTimerTick startTicks = UptimeInfo::Instance()->tTicks();
+  recordExpiration(startTicks, deadlineTicks);
+#else
+  (void)deadlineTicks;
+#endif
+  if (m_isCallback)
+  {
+    m_callback(this);
+  }
+  else
+  {
+    if (0 != overrunCount)
+    {
+      m_action->timeOverrun(overrunCount);
     }
+    m_action->timeExpired();
   }
+#ifdef SPINTIMER_STATISTICS
+  m_statistics.recordCallback(UptimeInfo::Instance()->tTicks() - startTicks);
+#endif
+}
+
+#ifdef SPINTIMER_STATISTICS
+void SpinTimer::recordExpiration(SpinTimerTick nowTicks, SpinTimerTick deadlineTicks)
+{
+  SpinTimerTickDiff latenessTicks = static_cast<SpinTimerTickDiff>(nowTicks - deadlineTicks);
+  m_statistics.recordExpiration((latenessTicks > 0) ? static_cast<SpinTimerTick>(latenessTicks) : 0);
 }
+#endif
@@ -8,20 +8,38 @@
 #ifndef SPINTIMER_H_
 #define SPINTIMER_H_
 
+#include "SpinTimerTick.h"
+#include "SpinTimerContext.h"
+
+class SpinTimerGroup;
+
 /**
- * Schedule all timers, check their expiration states.
- * @see SpinTimerContext::handleTick()
+ * Schedule all timers of the calling thread's context, check their expiration states.
+ * @see SpinTimerContext::current(), SpinTimerContext::handleTick()
  */
 void scheduleTimers();
 
 /**
- * Delay the caller by the mentioned time while all timers are kept being scheduled in the meanwhile.
+ * Delay the caller by the mentioned time while all timers of the calling thread's context (@see SpinTimerContext::current())
+ * are kept being scheduled in the meanwhile.
  * @param delayMillis Time to wait in [ms]
  *
+ * On POSIX systems the caller sleeps until the next timer expires instead of busy spinning
+ * (@see SpinTimerContext::nextExpiryMillis()).
+ *
  * This function is kept for backward compatibility, you can use the arduino delay() function instead.
  */
 void delayAndSchedule(unsigned long delayMillis);
 
+/**
+ * Schedule all timers of the calling thread's context and then sleep until the next timer expires, i.e. the whole
+ * body of a sleeping main loop. Timers with a slack tolerance (@see SpinTimer::setSlack()) get coalesced, which cuts
+ * down the number of wakeups.
+ * @param sleep Function suspending the caller for the specified time [ticks], i.e. entering an MCU low power mode;
+ *              default: 0 (POSIX systems: nanosleep(), otherwise no sleep)
+ */
+void scheduleTimersAndSleep(void (*sleep)(SpinTimerTick sleepTicks) = 0);
+
 /**
  * Action Interface, will notify timeExpired() event.
  * Implementations derived from this interface can be injected into a Timer object.
@@ -35,6 +53,13 @@ public:
    */
   virtual void timeExpired() = 0;
 
+  /**
+   * Time overrun event, notified right before timeExpired() when a fixed rate recurring timer has missed periods
+   * (@see SpinTimer::setRecurringPolicy()). May be overridden by specific Timer Action classes, default: ignore.
+   * @param overrunCount Number of missed periods, @see SpinTimer::getOverrunCount().
+   */
+  virtual void timeOverrun(unsigned long overrunCount) { (void)overrunCount; }
+
 protected:
   SpinTimerAction() { }
 
@@ -57,13 +82,24 @@ private:  // forbidden functions
  * - configurable to be either
  *   - recurring (timer automatically restarts after the interval) or
  *   - non-recurring (timer stops after timeout period is over)
+ * - recurring timers either restart from the time the expiration has been detected (fixed delay, default)
+ *   or from their previous deadline (fixed rate, no drift), @see setRecurringPolicy()
  * - timer interval/timeout time configurable ([ms])
- * - automatically attaches to SpinTimerContext's linked list of SpinTimer objects. As long as the
+ * - automatically attaches to SpinTimerContext's linked list of SpinTimer objects (in constant time), the calling
+ *   thread's default context (@see SpinTimerContext::current()) unless another context is specified. As long as the
  *   SpinTimerContext::handleTick() will be called (use global function scheduleTimers() to do so),
  *   this will periodically update the timers' states and thus perform the timers' expire evaluations
+ * - optional control from other threads than the one kicking its context, @see postStart(), postCancel()
  * - based on system uptime (number of milliseconds since the system began running the current program,
  *   i.e. Arduino: millis() function or STM32: HAL_GetTick() function),
  * - handles system time overflows correctly (unsigned long int type, occurring around every 50 hours)
+ * - optional high resolution 64 bit time base (@see SpinTimerTick.h), startTicks() allows sub-millisecond intervals
+ * - optional runtime statistics (@see SpinTimerStatistics.h, statistics())
+ * - optional event trace (@see SpinTimerTrace.h)
+ * - optional slack tolerance, the expiration may be delayed by up to the slack time in order to coalesce it with the
+ *   expirations of other timers (@see setSlack())
+ * - optional cheap restart for watchdog and debounce timers being restarted on every input event, @see restart()
+ * - optional groups, a SpinTimerGroup starts, cancels or pauses all its member timers at once (@see SpinTimerGroup.h)
  *
  * Integration:
  *
@@ -111,16 +147,31 @@ private:  // forbidden functions
 class SpinTimer
 {
   friend class SpinTimerContext;
+  friend class SpinTimerEngine;
+  friend class SpinTimerDispatcher;
+  friend class SpinTimerGroup;
 
 public:
+  /**
+   * Scheduling policy of a recurring timer, @see setRecurringPolicy().
+   */
+  enum RecurringPolicy
+  {
+    FIXED_DELAY,          /// Next interval starts when the expiration has been detected, late ticks delay all later expirations (default).
+    FIXED_RATE_CATCH_UP,  /// Next interval starts at the previous deadline; missed periods expire one by one with the subsequent ticks.
+    FIXED_RATE_SKIP       /// Next interval starts at the latest passed deadline; missed periods are skipped and counted.
+  };
+
   /**
    * Timer constructor.
    * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
    * @param action SpinTimerAction, is able to emit a timer expired event to any specific listener, default: 0 (no event will be sent)
    * @param isRecurring Operation mode, true: recurring, false: non-recurring, default: false
    * @param isAutostart Autostart mode, true: autostart enabled, false: autostart disabled, default: false
+   * @param context SpinTimerContext the timer attaches to, default: 0 (SpinTimerContext::current())
+   * @param slackMillis Slack tolerance [ms], @see setSlack(); default: 0 (expire exactly)
    */
-  SpinTimer(unsigned long timeMillis, SpinTimerAction* action = 0, bool isRecurring = false, bool isAutostart = false);
+  SpinTimer(unsigned long timeMillis, SpinTimerAction* action = 0, bool isRecurring = false, bool isAutostart = false, SpinTimerContext* context = 0, unsigned long slackMillis = 0);
 
   /**
    * Timer destructor.
@@ -140,7 +191,48 @@ public:
    */
   SpinTimerAction* action() const;
 
+  /**
+   * SpinTimerContext accessor method.
+   * @return SpinTimerContext object pointer the timer is attached to.
+   */
+  SpinTimerContext* context() const;
+
+#ifdef SPINTIMER_GROUPS
+  /**
+   * SpinTimerGroup accessor method (only available if SPINTIMER_GROUPS is defined).
+   * @return SpinTimerGroup object pointer the timer is member of, 0 if none (@see SpinTimerGroup::add()).
+   */
+  SpinTimerGroup* group() const;
+#endif
+
 protected:
+  /**
+   * Plain function being called out instead of an action's timeExpired() method, @see attachCallback().
+   * @param timer The expired timer, to be cast to the derived class attaching the function.
+   */
+  typedef void (*Callback)(SpinTimer* timer);
+
+  /**
+   * Attach a plain function to be called out when the timer expires, replaces an attached SpinTimerAction
+   * (the function and the action share their storage). Used by SpinTimerCallback, which stores the callable object inline.
+   * @param callback Function to be called out.
+   */
+  void attachCallback(Callback callback);
+
+  /**
+   * Let the time expired events of this timer always be notified inline by the thread kicking its context, also if the
+   * context has a dispatcher (@see SpinTimerContext::setDispatcher()); i.e. for timers resuming coroutines, which
+   * must be resumed by the thread owning them.
+   */
+  void bypassDispatcher();
+
+  /**
+   * Wait until no expiration of this timer is being run by the dispatcher anymore and apply its queued command.
+   * To be called by the destructors of derived classes before the state the notification depends on gets destroyed,
+   * ~SpinTimer() would wait too late; no effect without SPINTIMER_CROSS_THREAD_CONTROL.
+   */
+  void quiesce();
+
   /**
    * Get next SpinTimer object pointer out of the linked list containing timers.
    * @return SpinTimer object pointer or 0 if current object is the trailing list element.
@@ -153,6 +245,18 @@ protected:
    */
   void setNext(SpinTimer* timer);
 
+  /**
+   * Get previous SpinTimer object pointer out of the linked list containing timers.
+   * @return SpinTimer object pointer or 0 if current object is the leading list element.
+   */
+  SpinTimer* prev() const;
+
+  /**
+   * Set previous SpinTimer object of the linked list containing timers.
+   * @param timer SpinTimer object pointer to be set as the previous element of the list.
+   */
+  void setPrev(SpinTimer* timer);
+
 public:
   /**
    * Start or restart the timer with a specific time out or interval time.
@@ -160,18 +264,78 @@ public:
    */
   void start(unsigned long timeMillis);
 
+  /**
+   * Start or restart the timer with a specific time out or interval time and slack tolerance, @see setSlack().
+   * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
+   * @param slackMillis Slack tolerance [ms].
+   */
+  void start(unsigned long timeMillis, unsigned long slackMillis);
+
+  /**
+   * Start or restart the timer with a specific time out or interval time in the configured time base resolution.
+   * @param timeTicks Time out or interval time to be set for the timer [ticks] (@see SpinTimerTick.h); 0 will make the timer expire as soon as possible.
+   */
+  void startTicks(SpinTimerTick timeTicks);
+
   /**
    * Start or restart the timer.
    * The timer will expire after the specified time set with the constructor or start(timeMillis) before.
    */
   void start();
 
+  /**
+   * Restart the timer with its current interval time, optimized for timers getting restarted far more often than they
+   * expire (i.e. watchdog and debounce timers restarted on every input event).
+   * With SPINTIMER_LAZY_RESTART a running timer is re-armed lazily: only the restart time gets recorded, the timer is
+   * kept at its previous deadline by the context's engine (@see SpinTimerContext::setEngine()) and moved to the new one
+   * when the previous deadline comes up; so a restart costs a few stores even with a heap or wheel engine.
+   * Otherwise, and for a stopped timer, the restart is a start().
+   */
+  void restart();
+
+  /**
+   * Restart the timer with a time snapshot, @see restart(); i.e. the time stamp of the input event.
+   * A time snapshot earlier than the start of the running interval falls back to an immediate re-scheduling.
+   * @param currentTimeTicks Current up-time [ticks], @see UptimeInfo::tTicks().
+   */
+  void restart(SpinTimerTick currentTimeTicks);
+
   /**
    * Cancel the timer and stop. No time expired event will be sent out after the specified time would have been elapsed.
    * Subsequent isExpired() queries will return false.
    */
   void cancel();
 
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  /**
+   * Start or restart the timer from any thread, with a specific time out or interval time.
+   * The command is queued lock-free and gets applied by the thread kicking the timer's context, at the start of its next
+   * SpinTimerContext::handleTick() call. When several commands are posted before they get applied, the latest one wins.
+   * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
+   */
+  void postStart(unsigned long timeMillis);
+
+  /**
+   * Start or restart the timer from any thread, @see postStart(unsigned long timeMillis).
+   * The timer will expire after the specified time set with the constructor or start(timeMillis) before.
+   */
+  void postStart();
+
+  /**
+   * Cancel the timer from any thread, @see postStart(unsigned long timeMillis).
+   */
+  void postCancel();
+
+  /**
+   * Thread safe method to get the timer expire status, without re-evaluating whether the timer has expired
+   * (this is done by the thread kicking the timer's context).
+   * Subsequent fetchExpired() and isExpired() queries will return false after the first one returned true,
+   * as long as the time did not expire again in case of a recurring timer.
+   * @return true if the timer has expired.
+   */
+  bool fetchExpired();
+#endif
+
   /**
    * Poll method to get the timer expire status, recalculates whether the timer has expired before.
    * This method could be used in a pure polling mode, where tick() has not to get called
@@ -184,7 +348,8 @@ public:
   bool isExpired();
 
   /**
-   * Indicates whether the timer is currently running.
+   * Indicates whether the timer is currently running. A timer cancelled by its group (@see SpinTimerGroup::cancel())
+   * is not running anymore, a timer of a paused group is still running.
    * @return true if timer is running.
    */
   bool isRunning() const;
@@ -195,23 +360,200 @@ public:
    */
   unsigned long getInterval() const;
 
+  /**
+   * Returns the current interval of the timer in the configured time base resolution.
+   * @return Timer interval/timeout time [ticks].
+   */
+  SpinTimerTick getIntervalTicks() const;
+
+  /**
+   * Sets the slack tolerance, applies from the next interval started on.
+   * Each deadline gets delayed by less than the slack time, to the next multiple of the largest power of 2 [ticks]
+   * not exceeding the slack time (@see SpinTimerContext::coalesce()); so timers whose slack windows overlap expire
+   * within the same SpinTimerContext::handleTick() call and the context wakes up fewer times.
+   * @param slackMillis Slack tolerance [ms], 0: expire exactly (default).
+   */
+  void setSlack(unsigned long slackMillis);
+
+  /**
+   * Sets the slack tolerance in the configured time base resolution, @see setSlack().
+   * @param slackTicks Slack tolerance [ticks], 0: expire exactly (default).
+   */
+  void setSlackTicks(SpinTimerTick slackTicks);
+
+  /**
+   * Returns the slack tolerance.
+   * @return Slack tolerance [ms].
+   */
+  unsigned long getSlack() const;
+
+  /**
+   * Returns the slack tolerance in the configured time base resolution.
+   * @return Slack tolerance [ticks].
+   */
+  SpinTimerTick getSlackTicks() const;
+
     /**
    * Sets the operation mode
    * @param isRecurring Operation mode, true: recurring, false: non-recurring
    */
   void setIsRecurring(bool isRecurring);
 
+  /**
+   * Sets the scheduling policy of a recurring timer.
+   * @param policy FIXED_DELAY (default), FIXED_RATE_CATCH_UP or FIXED_RATE_SKIP.
+   */
+  void setRecurringPolicy(RecurringPolicy policy);
+
+  /**
+   * Returns the scheduling policy of a recurring timer.
+   * @return Current RecurringPolicy.
+   */
+  RecurringPolicy recurringPolicy() const;
+
+  /**
+   * Returns the number of periods a fixed rate recurring timer has missed at its latest expiration.
+   * FIXED_RATE_SKIP: number of periods skipped; FIXED_RATE_CATCH_UP: number of periods still due (backlog), 0 once caught up.
+   * @return Overrun count, always 0 with FIXED_DELAY.
+   */
+  unsigned long getOverrunCount() const;
+
   /**
    * Kick the Timer.
    * Recalculates whether the timer has expired.
    */
   void tick();
 
+  /**
+   * Kick the Timer with a time snapshot, i.e. taken once for all the timers by SpinTimerContext::handleTick().
+   * Recalculates whether the timer has expired, without reading the up-time info.
+   * @param currentTimeTicks Current up-time [ticks], @see UptimeInfo::tTicks().
+   */
+  void tick(SpinTimerTick currentTimeTicks);
+
+#ifdef SPINTIMER_STATISTICS
+  /**
+   * Runtime statistics accessor method (only available if SPINTIMER_STATISTICS is defined).
+   * The figures get written by the thread notifying the action, i.e. a worker of the context's dispatcher (@see
+   * SpinTimerContext::setDispatcher()); read and reset them while no notification of the timer is running.
+   * @return Fire count, lateness histogram and maximum time expired notification duration.
+   */
+  const SpinTimerStatistics& statistics() const;
+
+  /**
+   * Clear the runtime statistics.
+   */
+  void resetStatistics();
+#endif
+
 private:
   /**
    * Internal tick method, evaluates the expired state.
+   * @param currentTimeTicks Current up-time [ticks].
+   */
+  void internalTick(SpinTimerTick currentTimeTicks);
+
+  /**
+   * Evaluates whether the running interval is over at m_currentTimeTicks.
+   * @return true if the interval is over.
+   */
+  bool isIntervalOver() const;
+
+  /**
+   * Indicates whether the timer has been cancelled by its group, @see SpinTimerGroup::cancel().
+   * @return true if cancelled by the group, always false without SPINTIMER_GROUPS.
+   */
+  bool isCancelledByGroup() const;
+
+  /**
+   * Indicates whether the timer's deadline came up while its group is paused, @see SpinTimerGroup::pause().
+   * @return true if the timer is kept out of the engine, always false without SPINTIMER_GROUPS.
    */
-  void internalTick();
+  bool isParked() const;
+
+  /**
+   * Start the timer's interval from a specific point in time and schedule it.
+   * @param currentTimeTicks Interval start [ticks].
+   */
+  void startAt(SpinTimerTick currentTimeTicks);
+
+  /**
+   * Handles the expiration of the timer: restarts a recurring timer or stops a non-recurring one,
+   * sets the expired flag and emits the time expired event to the attached action.
+   */
+  void expire();
+
+  /**
+   * Set the expiration flag.
+   * @param isExpired New flag state.
+   */
+  inline void setExpiredFlag(bool isExpired)
+  {
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+    m_isExpiredFlag.store(isExpired, std::memory_order_release);
+#else
+    m_isExpiredFlag = isExpired;
+#endif
+  }
+
+  /**
+   * Read and clear the expiration flag.
+   * @return Flag state before clearing.
+   */
+  inline bool fetchExpiredFlag()
+  {
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+    // avoid the read-modify-write as long as the timer did not expire
+    return m_isExpiredFlag.load(std::memory_order_acquire) && m_isExpiredFlag.exchange(false, std::memory_order_acq_rel);
+#else
+    bool isExpired = m_isExpiredFlag;
+    m_isExpiredFlag = false;
+    return isExpired;
+#endif
+  }
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  /**
+   * Store a command for the thread kicking the timer's context and queue the timer unless it is queued already.
+   * The command and its interval time get stored with one atomic write, so commands posted concurrently by several
+   * threads do not get mixed up.
+   * @param command CMD_START, CMD_START_INTERVAL or CMD_CANCEL.
+   * @param delayTicks Interval time for CMD_START_INTERVAL [ticks], limited to 2^62 - 1 ticks.
+   */
+  void postCommand(unsigned int command, SpinTimerTick delayTicks);
+
+  /**
+   * Apply the latest posted command, called by SpinTimerContext::drainCommands().
+   */
+  void applyCommand();
+
+  /**
+   * Run the time expired events collected while being handed over to the context's dispatcher, called by the dispatcher
+   * (@see SpinTimerDispatcher::run()); keeps running until no further expiration is pending.
+   */
+  void runDispatched();
+#endif
+
+  /**
+   * Emit the time expired event to the attached callback or action.
+   * @param overrunCount Number of missed periods to be notified to the action, @see getOverrunCount().
+   * @param deadlineTicks Deadline the timer has expired at, the lateness gets recorded against it [ticks].
+   */
+  void notifyAction(unsigned long overrunCount, SpinTimerTick deadlineTicks);
+
+#ifdef SPINTIMER_STATISTICS
+  /**
+   * Record an expiration in the runtime statistics.
+   * @param nowTicks Time the expiration gets notified at [ticks].
+   * @param deadlineTicks Deadline the timer has expired at [ticks].
+   */
+  void recordExpiration(SpinTimerTick nowTicks, SpinTimerTick deadlineTicks);
+#endif
+
+  /**
+   * Starts the next interval of a fixed rate recurring timer from its previous deadline, updates the overrun count.
+   */
+  void startFixedRateInterval();
 
   /**
    * Starts time interval measurement, calculates the expiration trigger time.
@@ -219,6 +561,15 @@ private:
    */
   void startInterval();
 
+  /**
+   * Calculate the time left until the current interval is over, seen from a specific point in time.
+   * Handles unsigned long int overflows; intervals having started before currentTimeTicks are taken into account
+   * as long as they did not start more than half of the unsigned long range ago.
+   * @param currentTimeTicks Point in time the remaining time is related to [ticks].
+   * @return Time left [ticks], 0 if the interval is over.
+   */
+  SpinTimerTick remainingTicks(SpinTimerTick currentTimeTicks) const;
+
 public:
   /**
    * Constant for isRecurring parameter of the constructor (@see SpinTimer()), to create a one shot timer.
@@ -241,16 +592,77 @@ public:
   static const bool IS_AUTOSTART;
 
 private:
-  bool m_isRunning; /// Timer is running flag, true: timer is running, false: timer is stopped.
-  bool m_isRecurring; /// Timer mode flag, true: timer will automatically restart after expiration.
-  bool m_isExpiredFlag; /// Timer expiration flag.
-  bool m_willOverflow;  /// UptimeInfo::Instance()->tMillis() will overflow during new started interval.
-  unsigned long m_currentTimeMillis; /// interval time measurement base, updated every internalTick(), called either by tick() or by isExpired()
-  unsigned long m_triggerTimeMillis;
-  unsigned long m_triggerTimeMillisUpperLimit;
-  unsigned long m_delayMillis;
-  SpinTimerAction* m_action;
+  SpinTimerTick m_currentTimeTicks; /// interval time measurement base, updated every internalTick(), called either by tick() or by isExpired()
+  SpinTimerTick m_triggerTimeTicks; /// Deadline of the running interval, the interval has started at m_triggerTimeTicks - m_delayTicks.
+  SpinTimerTick m_delayTicks;
+  SpinTimerTick m_slackTicks;  /// Slack tolerance, the deadlines may be delayed by less than this time [ticks].
+  SpinTimerTick m_alignTicks;  /// Delay the running interval's deadline has been coalesced by [ticks].
+  unsigned long m_overrunCount; /// Number of periods missed at the latest expiration of a fixed rate recurring timer.
+  union
+  {
+    SpinTimerAction* m_action;  /// Action notified on expiration, valid if m_isCallback is not set.
+    Callback m_callback;        /// Function called out on expiration, valid if m_isCallback is set.
+  };
+  SpinTimerContext* m_context;  /// Context the timer is attached to.
   SpinTimer* m_next;
+  SpinTimer* m_prev;
+  SpinTimer* m_engineNext;   /// Link used by the SpinTimerEngine the timer is scheduled in.
+  SpinTimer* m_enginePrev;   /// Link used by the SpinTimerEngine the timer is scheduled in.
+  SpinTimer* m_engineChild;  /// Link used by the SpinTimerEngine the timer is scheduled in.
+  unsigned int m_engineTag;  /// SpinTimerEngine specific location of the timer, 0: not scheduled.
+  bool m_isRunning : 1; /// Timer is running flag, true: timer is running, false: timer is stopped.
+  bool m_isRecurring : 1; /// Timer mode flag, true: timer will automatically restart after expiration.
+  unsigned char m_recurringPolicy : 2; /// Scheduling policy of a recurring timer, @see RecurringPolicy.
+#ifdef SPINTIMER_BUDGET
+  bool m_isPending : 1; /// Notification of an expiration is pending in the context.
+#endif
+#ifdef SPINTIMER_LAZY_RESTART
+  bool m_isRearmPending : 1; /// Timer has been restarted lazily, the engine keeps it at its previous deadline.
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  bool m_isDispatcherBypassed : 1; /// Expirations are notified inline also if the context has a dispatcher, @see bypassDispatcher().
+#endif
+  bool m_isCallback; /// m_callback is attached instead of m_action; kept out of the bit fields, it is read by the dispatcher's threads.
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  std::atomic<bool> m_isExpiredFlag; /// Timer expiration flag, may be fetched by any thread.
+#else
+  bool m_isExpiredFlag; /// Timer expiration flag.
+#endif
+#ifdef SPINTIMER_LAZY_RESTART
+  SpinTimerTick m_rearmTicks;  /// Time of the latest lazy restart, @see restart(); valid if m_isRearmPending is set.
+#endif
+#ifdef SPINTIMER_BUDGET
+  SpinTimer* m_pendingNext;             /// Link of the context's pending notifications, @see SpinTimerContext::handleTick(SpinTimerTick, unsigned long).
+  SpinTimerTick m_pendingDeadlineTicks; /// Deadline of the expiration whose notification is pending [ticks].
+  unsigned long m_pendingOverruns;      /// Overrun count to be notified with the pending notification.
+#endif
+#ifdef SPINTIMER_STATISTICS
+  SpinTimerStatistics m_statistics;  /// Runtime statistics.
+#endif
+#ifdef SPINTIMER_GROUPS
+  SpinTimerGroup* m_group;   /// Group the timer is member of, 0: none.
+  SpinTimer* m_groupNext;    /// Link of the group's member list.
+  SpinTimer* m_groupPrev;    /// Link of the group's member list.
+  unsigned long m_groupGeneration;  /// Generation of the group at the timer's start, @see SpinTimerGroup::cancel().
+  SpinTimerTick m_groupShiftTicks;  /// Time the group had been paused at the timer's start, @see SpinTimerGroup::resume() [ticks].
+  bool m_isParked;           /// Deadline came up while the group is paused, the timer is kept out of the engine.
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  static const unsigned int CMD_NONE           = 0;  /// No command pending.
+  static const unsigned int CMD_START          = 1;  /// start() pending.
+  static const unsigned int CMD_START_INTERVAL = 2;  /// startTicks() pending.
+  static const unsigned int CMD_CANCEL         = 3;  /// cancel() pending.
+  static const unsigned int CMD_BITS           = 2;  /// Number of bits the command takes in m_command.
+  std::atomic<bool> m_isCommandQueued;               /// Timer is kept in the context's command queue.
+  std::atomic<unsigned long long> m_command;         /// Latest command posted by another thread, published as one word: the command in the lower CMD_BITS bits, the interval time of CMD_START_INTERVAL [ticks] above.
+  SpinTimer* m_commandNext;                          /// Link of the context's command queue.
+  std::atomic<unsigned long> m_dispatchCount;        /// Number of expirations handed over to the dispatcher and not run yet.
+  std::atomic<unsigned long> m_dispatchOverruns;     /// Overrun count to be notified with the next dispatched expiration.
+  SpinTimer* m_dispatchNext;                         /// Link of the list handed over to the dispatcher.
+#ifdef SPINTIMER_STATISTICS
+  std::atomic<SpinTimerTick> m_dispatchDeadlineTicks; /// Deadline of the latest expiration handed over to the dispatcher [ticks].
+#endif
+#endif
 
 private: // forbidden default functions
   SpinTimer& operator = (const SpinTimer& src); // assignment operator
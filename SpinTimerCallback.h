@@ -0,0 +1,99 @@
+/*
+ * SpinTimerCallback.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERCALLBACK_H_
+#define SPINTIMERCALLBACK_H_
+
+#include "SpinTimer.h"
+
+/**
+ * Spin Timer calling out a callable object (i.e. a lambda or a plain function) stored inline.
+ *
+ * Features:
+ * - no SpinTimerAction object has to be allocated, the callable object is part of the timer object
+ * - the callable object is called out through a plain function pointer to a type specific trampoline
+ *   (no virtual call), its call can be inlined into the trampoline
+ * - all the other SpinTimer features are available
+ *
+ * Integration:
+ *
+ *       unsigned int count = 0;
+ *       SpinTimerCallback<void (*)()> blinkTimer(200, toggleLed, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+ *
+ *       // C++17: the type of the callable object gets deduced
+ *       SpinTimerCallback countTimer(1000, [&count]() { count++; }, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+ *
+ * @tparam F Type of the callable object, to be called without arguments.
+ */
+template <typename F>
+class SpinTimerCallback : public SpinTimer
+{
+public:
+  /**
+   * Timer constructor.
+   * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
+   * @param callback Callable object, gets copied into the timer and called out when the timer expires.
+   * @param isRecurring Operation mode, true: recurring, false: non-recurring, default: false
+   * @param isAutostart Autostart mode, true: autostart enabled, false: autostart disabled, default: false
+   * @param context SpinTimerContext the timer attaches to, default: 0 (SpinTimerContext::current())
+   */
+  SpinTimerCallback(unsigned long timeMillis, const F& callback, bool isRecurring = false, bool isAutostart = false, SpinTimerContext* context = 0)
+  : SpinTimer(timeMillis, 0, isRecurring, IS_NON_AUTOSTART, context)
+  , m_callback(callback)
+  {
+    attachCallback(&SpinTimerCallback::invoke);
+    if (isAutostart)
+    {
+      start();
+    }
+  }
+
+  /**
+   * Timer destructor.
+   * Waits for the expirations being run by the dispatcher, the callable object gets destroyed afterwards.
+   */
+  virtual ~SpinTimerCallback()
+  {
+    quiesce();
+  }
+
+  /**
+   * Callable object accessor method.
+   * @return Reference to the callable object stored in the timer.
+   */
+  F& callback()
+  {
+    return m_callback;
+  }
+
+private:
+  /**
+   * Trampoline, calls out the callable object.
+   * @param timer The expired SpinTimerCallback object.
+   */
+  static void invoke(SpinTimer* timer)
+  {
+    static_cast<SpinTimerCallback*>(timer)->m_callback();
+  }
+
+private:
+  F m_callback;  /// Callable object.
+
+private: // forbidden functions
+  SpinTimerCallback(const SpinTimerCallback& src);              // copy constructor
+  SpinTimerCallback& operator = (const SpinTimerCallback& src); // assignment operator
+};
+
+#if __cplusplus >= 201703L
+/**
+ * Class template argument deduction guide, plain functions decay to function pointers.
+ */
+template <typename F>
+SpinTimerCallback(unsigned long timeMillis, F callback, bool isRecurring = false, bool isAutostart = false, SpinTimerContext* context = 0) -> SpinTimerCallback<F>;
+#endif
+
+#endif /* SPINTIMERCALLBACK_H_ */
@@ -0,0 +1,190 @@
+/*
+ * SpinTimerCompact.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERCOMPACT_H_
+#define SPINTIMERCOMPACT_H_
+
+#include "SpinTimerTick.h"
+#include "UptimeInfo.h"
+
+/**
+ * Compact polled timer.
+ *
+ * Features:
+ * - minimal footprint: interval start and interval time plus one byte of flags, no virtual functions, no links
+ *   (i.e. 12 bytes on a 32 bit MCU, 24 bytes on LP64 with the default time base); suitable for large arrays of timers
+ *   being embedded in application structures
+ * - not attached to any SpinTimerContext, the expiration gets detected by polling isExpired() (i.e. in the main loop),
+ *   no action is called out
+ * - branch free expiry test: the time elapsed since the interval start (unsigned difference, overflow safe) is compared
+ *   with the interval time; the semantics at the time base wrap (i.e. ULONG_MAX) are the same as the ones of SpinTimer
+ * - recurring timers restart at the time the expiration has been detected (SpinTimer::FIXED_DELAY)
+ *
+ * Integration:
+ *
+ *       SpinTimerCompact debounceTimers[64];
+ *
+ *       void loop()
+ *       {
+ *         for (unsigned int i = 0; i < 64; i++)
+ *         {
+ *           if (debounceTimers[i].isExpired())
+ *           {
+ *             // ..
+ *           }
+ *         }
+ *       }
+ */
+class SpinTimerCompact final
+{
+public:
+  /**
+   * Constructor.
+   * @param timeMillis Time out or interval time [ms], default: 0
+   * @param isRecurring Operation mode, true: recurring, false: non-recurring, default: false
+   * @param isAutostart Autostart mode, true: autostart enabled, false: autostart disabled, default: false
+   */
+  SpinTimerCompact(unsigned long timeMillis = 0, bool isRecurring = false, bool isAutostart = false)
+  : m_startTicks(0)
+  , m_delayTicks(static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI)
+  , m_flags(isRecurring ? FLAG_RECURRING : 0)
+  {
+    if (isAutostart)
+    {
+      start();
+    }
+  }
+
+  /**
+   * Start or restart the timer with a specific time out or interval time.
+   * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
+   */
+  void start(unsigned long timeMillis)
+  {
+    startTicks(static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI);
+  }
+
+  /**
+   * Start or restart the timer with a specific time out or interval time in the configured time base resolution.
+   * @param timeTicks Time out or interval time to be set for the timer [ticks].
+   */
+  void startTicks(SpinTimerTick timeTicks)
+  {
+    m_delayTicks = timeTicks;
+    start();
+  }
+
+  /**
+   * Start or restart the timer.
+   */
+  void start()
+  {
+    m_startTicks = UptimeInfo::Instance()->tTicks();
+    m_flags |= FLAG_RUNNING;
+  }
+
+  /**
+   * Cancel the timer and stop.
+   */
+  void cancel()
+  {
+    m_flags &= static_cast<unsigned char>(~FLAG_RUNNING);
+  }
+
+  /**
+   * Poll method to get the timer expire status, reads the current up-time.
+   * A recurring timer restarts, a non-recurring timer stops when an expiration is detected.
+   * @return true if the timer has expired.
+   */
+  bool isExpired()
+  {
+    return isExpired(UptimeInfo::Instance()->tTicks());
+  }
+
+  /**
+   * Poll method to get the timer expire status at a specific up-time, i.e. to test many timers against one reading.
+   * A recurring timer restarts, a non-recurring timer stops when an expiration is detected.
+   * @param nowTicks Current up-time [ticks].
+   * @return true if the timer has expired.
+   */
+  bool isExpired(SpinTimerTick nowTicks)
+  {
+    unsigned char isDue = static_cast<unsigned char>((nowTicks - m_startTicks) >= m_delayTicks) & m_flags & FLAG_RUNNING;
+
+    // due: a recurring timer restarts now, a non-recurring timer stops (both without branches)
+    SpinTimerTick restartMask = static_cast<SpinTimerTick>(0) - isDue;
+    m_startTicks = (nowTicks & restartMask) | (m_startTicks & ~restartMask);
+    m_flags &= static_cast<unsigned char>(~(isDue & ~(m_flags >> 1)));
+    return 0 != isDue;
+  }
+
+  /**
+   * Indicates whether the timer is currently running.
+   * @return true if timer is running.
+   */
+  bool isRunning() const
+  {
+    return 0 != (m_flags & FLAG_RUNNING);
+  }
+
+  /**
+   * Set the timer operation mode.
+   * @param isRecurring Operation mode, true: recurring, false: non-recurring
+   */
+  void setIsRecurring(bool isRecurring)
+  {
+    m_flags = static_cast<unsigned char>((m_flags & ~FLAG_RECURRING) | (isRecurring ? FLAG_RECURRING : 0));
+  }
+
+  /**
+   * Get the timer operation mode.
+   * @return true if the timer is recurring.
+   */
+  bool isRecurring() const
+  {
+    return 0 != (m_flags & FLAG_RECURRING);
+  }
+
+  /**
+   * Get the timeout or interval time.
+   * @return Timeout or interval time [ms].
+   */
+  unsigned long getInterval() const
+  {
+    return static_cast<unsigned long>(m_delayTicks / SPINTIMER_TICKS_PER_MILLI);
+  }
+
+  /**
+   * Get the timeout or interval time in the configured time base resolution.
+   * @return Timeout or interval time [ticks].
+   */
+  SpinTimerTick getIntervalTicks() const
+  {
+    return m_delayTicks;
+  }
+
+  /**
+   * Time left until the running interval is over.
+   * @param nowTicks Current up-time [ticks].
+   * @return Time left [ticks], 0 if the interval is over.
+   */
+  SpinTimerTick remainingTicks(SpinTimerTick nowTicks) const
+  {
+    SpinTimerTick elapsedTicks = nowTicks - m_startTicks;
+    return (elapsedTicks >= m_delayTicks) ? 0 : m_delayTicks - elapsedTicks;
+  }
+
+private:
+  static const unsigned char FLAG_RUNNING   = 0x01;  /// Timer is running.
+  static const unsigned char FLAG_RECURRING = 0x02;  /// Timer restarts after expiration, must be FLAG_RUNNING << 1.
+
+  SpinTimerTick m_startTicks;  /// Start time of the running interval [ticks].
+  SpinTimerTick m_delayTicks;  /// Time out or interval time [ticks].
+  unsigned char m_flags;       /// FLAG_RUNNING, FLAG_RECURRING
+};
+
+#endif /* SPINTIMERCOMPACT_H_ */
@@ -7,70 +7,588 @@
 
 #include "SpinTimerContext.h"
 
+#include <limits.h>
 #include "SpinTimer.h"
+#include "SpinTimerEngine.h"
+#include "SpinTimerSleepQueue.h"
+#include "UptimeInfo.h"
+#include "SpinTimerTrace.h"
 
-SpinTimerContext* SpinTimerContext::s_instance = (SpinTimerContext*)0;
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+#include <thread>
+#include "SpinTimerDispatcher.h"
+#endif
+
+const unsigned long SpinTimerContext::NO_EXPIRY = ULONG_MAX;
+const SpinTimerTick SpinTimerContext::NO_EXPIRY_TICKS = SPINTIMER_TICK_MAX;
+#ifdef SPINTIMER_BUDGET
+const SpinTimerTick SpinTimerContext::NO_TIME_BUDGET = SPINTIMER_TICK_MAX;
+const unsigned long SpinTimerContext::NO_CALLBACK_BUDGET = ULONG_MAX;
+#endif
+
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+thread_local SpinTimerContext* SpinTimerContext::s_current = 0;
+#endif
 
 SpinTimerContext* SpinTimerContext::instance()
 {
-  if (0 == s_instance)
+  // statically allocated, constructed on first use
+  static SpinTimerContext s_instance;
+  return &s_instance;
+}
+
+SpinTimerContext* SpinTimerContext::current()
+{
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+  if (0 != s_current)
   {
-    s_instance = new SpinTimerContext();
+    return s_current;
   }
-  return s_instance;
+#endif
+  return instance();
+}
+
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+SpinTimerContext* SpinTimerContext::threadInstance()
+{
+  static thread_local SpinTimerContext s_threadInstance;
+  s_threadInstance.makeCurrent();
+  return &s_threadInstance;
+}
+#endif
+
+void SpinTimerContext::makeCurrent()
+{
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+  s_current = this;
+#endif
 }
 
 void SpinTimerContext::attach(SpinTimer* timer)
 {
-  if (0 == m_timer)
+  timer->setNext(0);
+  timer->setPrev(m_lastTimer);
+  if (0 == m_lastTimer)
   {
     m_timer = timer;
   }
   else
   {
-    SpinTimer* next = m_timer;
-    while (next->next() != 0)
-    {
-      next = next->next();
-    }
-    next->setNext(timer);
+    m_lastTimer->setNext(timer);
   }
+  m_lastTimer = timer;
 }
 
 void SpinTimerContext::detach(SpinTimer* timer)
 {
-  if (m_timer == timer)
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  quiesce(timer);
+#endif
+
+  if (0 == timer->prev())
   {
     m_timer = timer->next();
   }
   else
   {
-    SpinTimer* next = m_timer;
-    while ((next != 0) && (next->next() != timer))
+    timer->prev()->setNext(timer->next());
+  }
+  if (0 == timer->next())
+  {
+    m_lastTimer = timer->prev();
+  }
+  else
+  {
+    timer->next()->setPrev(timer->prev());
+  }
+  timer->setNext(0);
+  timer->setPrev(0);
+  unschedule(timer);
+#ifdef SPINTIMER_BUDGET
+  if (timer->m_isPending)
+  {
+    removePending(timer);
+  }
+#endif
+}
+
+void SpinTimerContext::schedule(SpinTimer* timer)
+{
+  if (0 != m_engine)
+  {
+    m_engine->schedule(timer);
+  }
+}
+
+void SpinTimerContext::unschedule(SpinTimer* timer)
+{
+  if (0 != m_engine)
+  {
+    m_engine->unschedule(timer);
+  }
+}
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+void SpinTimerContext::post(SpinTimer* timer)
+{
+  SpinTimer* head = m_commands.load(std::memory_order_relaxed);
+  do
+  {
+    timer->m_commandNext = head;
+  }
+  while (!m_commands.compare_exchange_weak(head, timer, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void SpinTimerContext::drainCommands()
+{
+  SpinTimer* stack = m_commands.exchange(0, std::memory_order_acquire);
+
+  // reverse the stack, apply the commands in the order they have been posted
+  SpinTimer* queue = 0;
+  while (0 != stack)
+  {
+    SpinTimer* next = stack->m_commandNext;
+    stack->m_commandNext = queue;
+    queue = stack;
+    stack = next;
+  }
+
+  while (0 != queue)
+  {
+    SpinTimer* timer = queue;
+    queue = timer->m_commandNext;
+    timer->m_commandNext = 0;
+    timer->applyCommand();
+  }
+}
+
+void SpinTimerContext::dispatch(SpinTimer* timer)
+{
+  timer->m_dispatchNext = 0;
+  if (!m_isHandlingTick)
+  {
+    // i.e. expired with isExpired()
+    m_dispatcher->dispatch(timer);
+    return;
+  }
+
+  if (0 == m_dispatchLast)
+  {
+    m_dispatchFirst = timer;
+  }
+  else
+  {
+    m_dispatchLast->m_dispatchNext = timer;
+  }
+  m_dispatchLast = timer;
+}
+
+void SpinTimerContext::setDispatcher(SpinTimerDispatcher* dispatcher)
+{
+  m_dispatcher = dispatcher;
+}
+
+SpinTimerDispatcher* SpinTimerContext::dispatcher() const
+{
+  return m_dispatcher;
+}
+
+void SpinTimerContext::quiesce(SpinTimer* timer)
+{
+  if (timer->m_isCommandQueued.load(std::memory_order_acquire))
+  {
+    // the queue must not keep a reference to the timer
+    drainCommands();
+  }
+  while (0 != timer->m_dispatchCount.load(std::memory_order_acquire))
+  {
+    // the dispatcher must not keep a reference to the timer
+    std::this_thread::yield();
+  }
+}
+#endif
+
+#ifdef SPINTIMER_BUDGET
+void SpinTimerContext::defer(SpinTimer* timer, SpinTimerTick deadlineTicks, unsigned long overrunCount)
+{
+  if (timer->m_isPending)
+  {
+    // notified once, the expiration counts as overrun
+    timer->m_pendingOverruns += 1 + overrunCount;
+    return;
+  }
+  timer->m_isPending = true;
+  timer->m_pendingDeadlineTicks = deadlineTicks;
+  timer->m_pendingOverruns = overrunCount;
+  timer->m_pendingNext = 0;
+  if (0 == m_deferLast)
+  {
+    m_deferFirst = timer;
+  }
+  else
+  {
+    m_deferLast->m_pendingNext = timer;
+  }
+  m_deferLast = timer;
+  m_pendingCount++;
+}
+
+void SpinTimerContext::removePending(SpinTimer* timer)
+{
+  SpinTimer** link = &m_pendingFirst;
+  while ((0 != *link) && (timer != *link))
+  {
+    link = &(*link)->m_pendingNext;
+  }
+  if (0 == *link)
+  {
+    // deferred by the running handleTick() call
+    SpinTimer* prev = 0;
+    link = &m_deferFirst;
+    while ((0 != *link) && (timer != *link))
     {
-      next = next->next();
+      prev = *link;
+      link = &(*link)->m_pendingNext;
     }
-    if (next != 0)
+    if (m_deferLast == timer)
     {
-      next->setNext(timer->next());
+      m_deferLast = prev;
     }
   }
+  if (0 != *link)
+  {
+    *link = timer->m_pendingNext;
+    m_pendingCount--;
+  }
+  timer->m_pendingNext = 0;
+  timer->m_isPending = false;
 }
 
+bool SpinTimerContext::handleTick(SpinTimerTick budgetTicks, unsigned long maxCallbacks)
+{
+  SpinTimerTick startTicks = UptimeInfo::Instance()->tTicks();
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  if (0 != m_dispatcher)
+  {
+    handleTick();
+    return true;
+  }
+#endif
+
+  // detect the expirations, the notifications get deferred
+  m_isDeferring = true;
+  handleTick();
+  m_isDeferring = false;
+
+  if (0 != m_deferFirst)
+  {
+    // the deadlines left over from earlier calls are earlier or equal, they stay ahead on equal deadlines
+    m_pendingFirst = mergePending(m_pendingFirst, sortPending(m_deferFirst));
+    m_deferFirst = 0;
+    m_deferLast = 0;
+  }
+  runPending(startTicks, budgetTicks, maxCallbacks);
+  return 0 == m_pendingFirst;
+}
+
+unsigned long SpinTimerContext::pendingCount() const
+{
+  return m_pendingCount;
+}
+
+void SpinTimerContext::runPending(SpinTimerTick startTicks, SpinTimerTick budgetTicks, unsigned long maxCallbacks)
+{
+  unsigned long callbacks = 0;
+  while (0 != m_pendingFirst)
+  {
+    if (0 != callbacks)
+    {
+      if (callbacks >= maxCallbacks)
+      {
+        break;
+      }
+      if ((NO_TIME_BUDGET != budgetTicks) && (UptimeInfo::Instance()->tTicks() - startTicks >= budgetTicks))
+      {
+        break;
+      }
+    }
+    SpinTimer* timer = m_pendingFirst;
+    m_pendingFirst = timer->m_pendingNext;
+    timer->m_pendingNext = 0;
+    timer->m_isPending = false;
+    m_pendingCount--;
+    unsigned long overrunCount = timer->m_pendingOverruns;
+    timer->m_pendingOverruns = 0;
+    if (timer->isCancelledByGroup())
+    {
+      // the group has been cancelled meanwhile
+      continue;
+    }
+    timer->notifyAction(overrunCount, timer->m_pendingDeadlineTicks);
+    callbacks++;
+  }
+}
+
+SpinTimer* SpinTimerContext::sortPending(SpinTimer* list)
+{
+  if ((0 == list) || (0 == list->m_pendingNext))
+  {
+    return list;
+  }
+
+  // split into halves
+  SpinTimer* slow = list;
+  SpinTimer* fast = list->m_pendingNext;
+  while ((0 != fast) && (0 != fast->m_pendingNext))
+  {
+    slow = slow->m_pendingNext;
+    fast = fast->m_pendingNext->m_pendingNext;
+  }
+  SpinTimer* second = slow->m_pendingNext;
+  slow->m_pendingNext = 0;
+  return mergePending(sortPending(list), sortPending(second));
+}
+
+SpinTimer* SpinTimerContext::mergePending(SpinTimer* first, SpinTimer* second)
+{
+  SpinTimer* head = 0;
+  SpinTimer** tail = &head;
+  while ((0 != first) && (0 != second))
+  {
+    // wrap-safe deadline compare
+    if (static_cast<SpinTimerTickDiff>(second->m_pendingDeadlineTicks - first->m_pendingDeadlineTicks) < 0)
+    {
+      *tail = second;
+      second = second->m_pendingNext;
+    }
+    else
+    {
+      *tail = first;
+      first = first->m_pendingNext;
+    }
+    tail = &(*tail)->m_pendingNext;
+  }
+  *tail = (0 != first) ? first : second;
+  return head;
+}
+#endif
+
 void SpinTimerContext::handleTick()
 {
+#ifdef SPINTIMER_BUDGET
+  if ((0 != m_pendingFirst) && !m_isDeferring)
+  {
+    // notifications left over by budgeted calls are the most overdue ones
+    runPending(0, NO_TIME_BUDGET, NO_CALLBACK_BUDGET);
+  }
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  if (0 != m_commands.load(std::memory_order_relaxed))
+  {
+    drainCommands();
+  }
+#endif
+  SpinTimerTick nowTicks = UptimeInfo::Instance()->tTicks();
+#ifdef SPINTIMER_STATISTICS
+  m_visitedCount = 0;
+#endif
+#ifdef SPINTIMER_TRACE
+  SpinTimerTrace::emit(SpinTimerTrace::EVENT_TICK_BEGIN, this, nowTicks, 0);
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  if (0 != m_dispatcher)
+  {
+    m_isHandlingTick = true;
+    tickTimers(nowTicks);
+    m_isHandlingTick = false;
+    if (0 != m_dispatchFirst)
+    {
+      SpinTimer* timers = m_dispatchFirst;
+      m_dispatchFirst = 0;
+      m_dispatchLast = 0;
+      m_dispatcher->dispatch(timers);
+    }
+  }
+  else
+#endif
+  {
+    tickTimers(nowTicks);
+  }
+#ifdef SPINTIMER_STATISTICS
+  m_statistics.recordTick(UptimeInfo::Instance()->tTicks() - nowTicks, m_visitedCount);
+#endif
+#ifdef SPINTIMER_TRACE
+  SpinTimerTrace::emit(SpinTimerTrace::EVENT_TICK_END, this, UptimeInfo::Instance()->tTicks(), 0);
+#endif
+}
+
+void SpinTimerContext::tickTimers(SpinTimerTick nowTicks)
+{
+  if (0 != m_engine)
+  {
+    // the expiring timers count themselves as visited
+    m_engine->handleTick(nowTicks);
+    return;
+  }
+
+#ifdef SPINTIMER_STATISTICS
+  unsigned long visitedCount = 0;
+#endif
+  SpinTimer* timer = m_timer;
+  while (timer != 0)
+  {
+    timer->tick(nowTicks);
+    timer = timer->next();
+#ifdef SPINTIMER_STATISTICS
+    visitedCount++;
+#endif
+  }
+#ifdef SPINTIMER_STATISTICS
+  m_visitedCount = visitedCount;
+#endif
+}
+
+unsigned long SpinTimerContext::nextExpiryMillis()
+{
+  SpinTimerTick nextTicks = nextExpiryTicks();
+  if (NO_EXPIRY_TICKS == nextTicks)
+  {
+    return NO_EXPIRY;
+  }
+
+  // round up, a timer must not be reported to expire earlier than it does
+  SpinTimerTick nextMillis = (nextTicks + SPINTIMER_TICKS_PER_MILLI - 1) / SPINTIMER_TICKS_PER_MILLI;
+  return (nextMillis >= NO_EXPIRY) ? NO_EXPIRY - 1 : static_cast<unsigned long>(nextMillis);
+}
+
+SpinTimerTick SpinTimerContext::nextExpiryTicks()
+{
+#ifdef SPINTIMER_BUDGET
+  if (0 != m_pendingFirst)
+  {
+    // notifications pending, to be continued right away
+    return 0;
+  }
+#endif
+
+  SpinTimerTick nowTicks = UptimeInfo::Instance()->tTicks();
+  if (0 != m_engine)
+  {
+    return m_engine->nextExpiryTicks(nowTicks);
+  }
+
+  SpinTimerTick nextTicks = NO_EXPIRY_TICKS;
   SpinTimer* timer = m_timer;
   while (timer != 0)
   {
-    timer->tick();
+    if (timer->isRunning() && !timer->isParked())
+    {
+      SpinTimerTick leftTicks = timer->remainingTicks(nowTicks);
+      if (leftTicks < nextTicks)
+      {
+        nextTicks = leftTicks;
+      }
+    }
+    timer = timer->next();
+  }
+  return nextTicks;
+}
+
+void SpinTimerContext::setEngine(SpinTimerEngine* engine)
+{
+  SpinTimer* timer = m_timer;
+  while ((0 != m_engine) && (timer != 0))
+  {
+    m_engine->unschedule(timer);
     timer = timer->next();
   }
+
+  m_engine = engine;
+  if (0 != m_engine)
+  {
+    m_engine->reset(UptimeInfo::Instance()->tTicks());
+    timer = m_timer;
+    while (timer != 0)
+    {
+      if (timer->isRunning() && !timer->isParked())
+      {
+        m_engine->schedule(timer);
+      }
+      timer = timer->next();
+    }
+  }
+}
+
+SpinTimerEngine* SpinTimerContext::engine() const
+{
+  return m_engine;
 }
 
+SpinTimerTick SpinTimerContext::coalesce(SpinTimerTick deadlineTicks, SpinTimerTick slackTicks)
+{
+  SpinTimerTick gridTicks = 1;
+  while (gridTicks <= slackTicks / 2)
+  {
+    gridTicks <<= 1;
+  }
+  // round up to the grid, wraps around consistently as the grid divides the time base range
+  return (deadlineTicks + gridTicks - 1) & ~(gridTicks - 1);
+}
+
+SpinTimerSleepQueue* SpinTimerContext::sleepQueue()
+{
+  if (0 == m_sleepQueue)
+  {
+    m_sleepQueue = new SpinTimerSleepQueue(this);
+  }
+  return m_sleepQueue;
+}
+
+#ifdef SPINTIMER_STATISTICS
+const SpinTimerContextStatistics& SpinTimerContext::statistics() const
+{
+  return m_statistics;
+}
+
+void SpinTimerContext::resetStatistics()
+{
+  m_statistics.reset();
+}
+#endif
+
 SpinTimerContext::SpinTimerContext()
 : m_timer(0)
+, m_lastTimer(0)
+, m_engine(0)
+, m_sleepQueue(0)
+#ifdef SPINTIMER_BUDGET
+, m_pendingFirst(0)
+, m_deferFirst(0)
+, m_deferLast(0)
+, m_pendingCount(0)
+, m_isDeferring(false)
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+, m_commands(0)
+, m_dispatcher(0)
+, m_dispatchFirst(0)
+, m_dispatchLast(0)
+, m_isHandlingTick(false)
+#endif
+#ifdef SPINTIMER_STATISTICS
+, m_visitedCount(0)
+#endif
 { }
 
 SpinTimerContext::~SpinTimerContext()
-{ }
+{
+  delete m_sleepQueue;
+  m_sleepQueue = 0;
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+  if (this == s_current)
+  {
+    s_current = 0;
+  }
+#endif
+}
 
@@ -8,7 +8,32 @@
 #ifndef SPINTIMERCONTEX_H_
 #define SPINTIMERCONTEX_H_
 
+#include "SpinTimerTick.h"
+#include "SpinTimerStatistics.h"
+
+/**
+ * Opt-in features, selected at compile time (each one adds fields to every SpinTimer object):
+ * - SPINTIMER_CROSS_THREAD_CONTROL defined: timers can be controlled from other threads (@see SpinTimer::postStart()),
+ *   their actions can be run by a dispatcher (@see SpinTimerContext::setDispatcher()); not available on Arduino
+ * - SPINTIMER_BUDGET defined: time and callback count budgeted handleTick() calls,
+ *   @see SpinTimerContext::handleTick(SpinTimerTick, unsigned long)
+ * - SPINTIMER_LAZY_RESTART defined: SpinTimer::restart() re-arms running timers lazily, otherwise it is a start()
+ * - SPINTIMER_STATISTICS, SPINTIMER_TRACE, SPINTIMER_GROUPS: @see SpinTimerStatistics.h, SpinTimerTrace.h, SpinTimerGroup.h
+ */
+#if !defined(ARDUINO) && (__cplusplus >= 201103L)
+#define SPINTIMER_THREAD_LOCAL_CONTEXT  /// Thread local default context supported, @see SpinTimerContext::current().
+#else
+#undef SPINTIMER_CROSS_THREAD_CONTROL   /// Needs the C++11 atomics and threads.
+#endif
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+#include <atomic>
+#endif
+
 class SpinTimer;
+class SpinTimerEngine;
+class SpinTimerDispatcher;
+class SpinTimerSleepQueue;
 
 /**
  * Spin Timer Context.
@@ -28,22 +53,77 @@ class SpinTimer;
  *         // .. do something
  *       }
  *
- * - holds a single linked list of registered SpinTimer objects,
+ * - holds a double linked list of registered SpinTimer objects,
  *   the SpinTimers automatically attach themselves to this on their creation
- *   and automatically detach themselves on their destruction.
- * - is a Singleton
+ *   and automatically detach themselves on their destruction, both in constant time.
+ * - kicks all the registered SpinTimer objects on each handleTick() call by default; a SpinTimerEngine
+ *   (i.e. SpinTimerWheel) can be injected with setEngine() in order to only visit the timers whose time has come
+ * - the process wide instance() is the default context; further independent contexts can be created,
+ *   i.e. one per thread, each one kicked by its own loop without any contention:
+ *
+ *       void worker()
+ *       {
+ *         SpinTimerContext* context = SpinTimerContext::threadInstance();  // the calling thread's default context
+ *         SpinTimer timer(100, new MyAction(), SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);  // attaches to context
+ *         for (;;)
+ *         {
+ *           scheduleTimers();  // kicks context
+ *         }
+ *       }
+ *
+ * - a context and its timers are not thread safe, they must be used by one thread only (the owner thread);
+ *   a context must outlive the timers attached to it
+ * - if SPINTIMER_CROSS_THREAD_CONTROL is defined, other threads can start and cancel the timers by posting commands
+ *   (@see SpinTimer::postStart(), SpinTimer::postCancel()), kept in a lock-free multi producer single consumer queue,
+ *   which is drained by the owner thread at the start of each handleTick() call
+ * - runs the actions of the expired timers inline by default; if SPINTIMER_CROSS_THREAD_CONTROL is defined,
+ *   a SpinTimerDispatcher (i.e. SpinTimerWorkerPool) can be injected with setDispatcher() in order to run them on other
+ *   threads, the expirations being detected by the owner thread
+ * - records runtime statistics if SPINTIMER_STATISTICS is defined, @see statistics()
+ * - provides a queue of lightweight sleepers on demand (@see sleepQueue()), woken up from handleTick()
+ * - if SPINTIMER_BUDGET is defined, a time and/or callback count budget can be set per handleTick() call
+ *   (@see handleTick(SpinTimerTick, unsigned long)), the notifications of the expired timers left over get resumed
+ *   with the subsequent calls, most overdue first
  */
 class SpinTimerContext
 {
   friend class SpinTimer;
+  friend class SpinTimerGroup;
 
 public:
   /**
-   * Create and/or return singleton instance of SpinTimerContext.
+   * Create and/or return singleton instance of SpinTimerContext (statically allocated, no heap memory is used).
    * @return Pointer to singleton SpinTimerContext object pointer.
    */
   static SpinTimerContext* instance();
 
+  /**
+   * Default context of the calling thread, the SpinTimer objects attach to this context unless another one is specified,
+   * scheduleTimers() and delayAndSchedule() kick this context.
+   * @return Context made current for the calling thread by makeCurrent() or threadInstance(), instance() otherwise.
+   */
+  static SpinTimerContext* current();
+
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+  /**
+   * Create and/or return the calling thread's own context instance and make it current() for this thread.
+   * The instance gets destroyed when the thread exits.
+   * @return Pointer to the calling thread's SpinTimerContext object.
+   */
+  static SpinTimerContext* threadInstance();
+#endif
+
+  /**
+   * Make this context the default context of the calling thread, @see current().
+   * Only the process wide instance() is available as default context when thread local storage is not supported.
+   */
+  void makeCurrent();
+
+  /**
+   * Constructor, creates an independent context, i.e. to be used by another thread.
+   */
+  SpinTimerContext();
+
   /**
    * Destructor.
    */
@@ -51,32 +131,258 @@ public:
 
 protected:
   /**
-   * Add a SpinTimer object to the single linked list.
+   * Add a SpinTimer object to the end of the double linked list.
    * @param timer SpinTimer object pointer.
    */
   void attach(SpinTimer* timer);
 
   /**
-   * Remove specified SpinTimer object from the single linked list.
+   * Remove specified SpinTimer object from the double linked list.
    * @param timer SpinTimer object pointer.
    */
   void detach(SpinTimer* timer);
 
+  /**
+   * Notify the engine about a (re-)started SpinTimer object.
+   * @param timer SpinTimer object pointer.
+   */
+  void schedule(SpinTimer* timer);
+
+  /**
+   * Notify the engine about a stopped SpinTimer object.
+   * @param timer SpinTimer object pointer.
+   */
+  void unschedule(SpinTimer* timer);
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  /**
+   * Add a SpinTimer object with a pending command to the command queue, may be called by any thread (lock-free).
+   * @param timer SpinTimer object pointer, must not be queued yet.
+   */
+  void post(SpinTimer* timer);
+
+  /**
+   * Apply the pending commands of all the queued SpinTimer objects, in the order they have been posted.
+   * To be called by the owner thread.
+   */
+  void drainCommands();
+
+  /**
+   * Hand over an expired SpinTimer object to the dispatcher; collected during handleTick() and handed over at its end.
+   * @param timer SpinTimer object pointer.
+   */
+  void dispatch(SpinTimer* timer);
+
+  /**
+   * Release all the references the command queue and the dispatcher keep to a SpinTimer object: apply its queued
+   * command and wait until its expirations handed over to the dispatcher have been run.
+   * @param timer SpinTimer object pointer.
+   */
+  void quiesce(SpinTimer* timer);
+#endif
+
+#ifdef SPINTIMER_BUDGET
+  /**
+   * Defer the notification of an expired SpinTimer object, called during a budgeted handleTick() call.
+   * A timer whose notification is pending already accumulates the expiration as overrun.
+   * @param timer SpinTimer object pointer.
+   * @param deadlineTicks Deadline the timer has expired at [ticks].
+   * @param overrunCount Overrun count of the expiration.
+   */
+  void defer(SpinTimer* timer, SpinTimerTick deadlineTicks, unsigned long overrunCount);
+
+  /**
+   * Drop the pending notification of a SpinTimer object, i.e. being cancelled or destroyed.
+   * @param timer SpinTimer object pointer, its notification must be pending.
+   */
+  void removePending(SpinTimer* timer);
+#endif
+
 public:
   /**
-   * Kick all attached SpinTimer objects (calls the SpinTimer::tick() method).
+   * Kick all attached SpinTimer objects (calls the SpinTimer::tick() method),
+   * or let the engine dispatch the expired timers if an engine has been set.
+   * The up-time info is read once per call, all timers are evaluated against this time snapshot.
    */
   void handleTick();
 
+#ifdef SPINTIMER_BUDGET
+  /**
+   * Kick the timers like handleTick() (only available if SPINTIMER_BUDGET is defined), but stop notifying the expired
+   * timers (calling out their actions or callbacks) as soon as a budget runs out; the pending notifications are kept and continued with the next handleTick() call,
+   * the most overdue (earliest deadline) first. So the duration of a call stays bounded, however many timers are due.
+   * - at least one pending notification is run per call, the backlog always makes progress
+   * - a recurring timer expiring again while its notification is pending gets notified once, with the missed
+   *   expirations added to the overrun count
+   * - cancelling or destroying a timer drops its pending notification
+   * - handleTick() without budget runs all pending notifications first
+   * - with a dispatcher (@see setDispatcher()) the budget does not apply, the notifications are run by the dispatcher
+   * @param budgetTicks Time budget of the call, including the expiration detection [ticks]; NO_TIME_BUDGET: unlimited.
+   * @param maxCallbacks Maximum number of notifications run by the call; NO_CALLBACK_BUDGET: unlimited.
+   * @return true if all the notifications have been run, false if notifications are pending (@see pendingCount()).
+   */
+  bool handleTick(SpinTimerTick budgetTicks, unsigned long maxCallbacks = NO_CALLBACK_BUDGET);
+
+  /**
+   * Number of expired timers whose notifications are pending, @see handleTick(SpinTimerTick, unsigned long).
+   * @return Number of pending notifications.
+   */
+  unsigned long pendingCount() const;
+#endif
+
 private:
   /**
-   * Constructor.
+   * Evaluate the timers, either by the engine or by kicking all of them.
+   * @param nowTicks Current up-time [ticks].
    */
-  SpinTimerContext();
+  void tickTimers(SpinTimerTick nowTicks);
+
+#ifdef SPINTIMER_BUDGET
+  /**
+   * Run pending notifications, most overdue first, until a budget runs out.
+   * @param startTicks Up-time the budget is accounted from [ticks].
+   * @param budgetTicks Time budget [ticks], NO_TIME_BUDGET: unlimited.
+   * @param maxCallbacks Maximum number of notifications, NO_CALLBACK_BUDGET: unlimited.
+   */
+  void runPending(SpinTimerTick startTicks, SpinTimerTick budgetTicks, unsigned long maxCallbacks);
+
+  /**
+   * Sort a list of deferred timers by their deadlines (stable merge sort).
+   * @param list First element of the list, linked by the pending links.
+   * @return First element of the sorted list.
+   */
+  static SpinTimer* sortPending(SpinTimer* list);
+
+  /**
+   * Merge two lists of deferred timers, sorted by their deadlines; on equal deadlines the elements of the first list come first.
+   * @param first First element of the first list.
+   * @param second First element of the second list.
+   * @return First element of the merged list.
+   */
+  static SpinTimer* mergePending(SpinTimer* first, SpinTimer* second);
+#endif
+
+public:
+
+  /**
+   * Time left until the earliest running timer expires.
+   * Allows the caller to sleep instead of spinning while no timer is due.
+   * @return Time left [ms], 0 if a timer is due already, NO_EXPIRY if no timer is running.
+   */
+  unsigned long nextExpiryMillis();
+
+  /**
+   * Time left until the earliest running timer expires, in the configured time base resolution (@see SpinTimerTick.h).
+   * @return Time left [ticks], 0 if a timer is due already, NO_EXPIRY_TICKS if no timer is running.
+   */
+  SpinTimerTick nextExpiryTicks();
+
+  /**
+   * Set the engine keeping track of the running timers, acts as dependency injection. @see SpinTimerEngine interface.
+   * All running timers get handed over to the new engine.
+   * @param engine Specific SpinTimerEngine, 0: kick all timers on each handleTick() call (default).
+   */
+  void setEngine(SpinTimerEngine* engine);
+
+  /**
+   * SpinTimerEngine accessor method.
+   * @return SpinTimerEngine object pointer or 0 if no engine is set.
+   */
+  SpinTimerEngine* engine() const;
+
+  /**
+   * Coalesce a deadline within its slack window: the deadline gets delayed to the next multiple of the largest power
+   * of 2 not exceeding the slack time. The grid is aligned to the absolute up-time, so all the deadlines of the
+   * context falling into the same grid interval are aligned to the same point in time and expire together, whatever
+   * their start times and intervals are; the powers of 2 keep the alignment consistent across a time base wrap.
+   * @param deadlineTicks Exact deadline [ticks].
+   * @param slackTicks Slack tolerance [ticks], 0 or 1: the deadline is kept.
+   * @return Coalesced deadline, deadlineTicks .. deadlineTicks + slackTicks - 1 [ticks].
+   */
+  static SpinTimerTick coalesce(SpinTimerTick deadlineTicks, SpinTimerTick slackTicks);
+
+  /**
+   * Sleep queue accessor method, the queue gets created on the first call and is owned by the context.
+   * @return SpinTimerSleepQueue object pointer, @see SpinTimerSleepQueue.
+   */
+  SpinTimerSleepQueue* sleepQueue();
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  /**
+   * Set the dispatcher running the actions of the expired timers, acts as dependency injection. @see SpinTimerDispatcher interface.
+   * @param dispatcher Specific SpinTimerDispatcher, 0: run the actions inline (default).
+   */
+  void setDispatcher(SpinTimerDispatcher* dispatcher);
+
+  /**
+   * SpinTimerDispatcher accessor method.
+   * @return SpinTimerDispatcher object pointer or 0 if no dispatcher is set.
+   */
+  SpinTimerDispatcher* dispatcher() const;
+#endif
+
+#ifdef SPINTIMER_STATISTICS
+  /**
+   * Runtime statistics accessor method (only available if SPINTIMER_STATISTICS is defined).
+   * @return handleTick() durations and number of timers visited per handleTick() call.
+   */
+  const SpinTimerContextStatistics& statistics() const;
+
+  /**
+   * Clear the runtime statistics.
+   */
+  void resetStatistics();
+#endif
+
+public:
+  /**
+   * Constant returned by nextExpiryMillis() when no timer is running.
+   */
+  static const unsigned long NO_EXPIRY;
+
+  /**
+   * Constant returned by nextExpiryTicks() when no timer is running.
+   */
+  static const SpinTimerTick NO_EXPIRY_TICKS;
+
+#ifdef SPINTIMER_BUDGET
+  /**
+   * Constant for the budgetTicks parameter of handleTick(SpinTimerTick, unsigned long), no time limit.
+   */
+  static const SpinTimerTick NO_TIME_BUDGET;
+
+  /**
+   * Constant for the maxCallbacks parameter of handleTick(SpinTimerTick, unsigned long), no callback count limit.
+   */
+  static const unsigned long NO_CALLBACK_BUDGET;
+#endif
 
 private:
-  static SpinTimerContext* s_instance; /// SpinTimerContext singleton instance variable.
-  SpinTimer* m_timer; /// Root node of single linked list containing the timers to be kicked.
+#ifdef SPINTIMER_THREAD_LOCAL_CONTEXT
+  static thread_local SpinTimerContext* s_current; /// Default context of the thread, 0: instance().
+#endif
+  SpinTimer* m_timer; /// Root node of double linked list containing the timers to be kicked.
+  SpinTimer* m_lastTimer; /// Trailing node of double linked list containing the timers to be kicked.
+  SpinTimerEngine* m_engine; /// Engine keeping track of the running timers, 0: none.
+  SpinTimerSleepQueue* m_sleepQueue; /// Queue of lightweight sleepers, 0: not created yet.
+#ifdef SPINTIMER_BUDGET
+  SpinTimer* m_pendingFirst; /// Expired timers whose notifications are pending, most overdue first.
+  SpinTimer* m_deferFirst; /// Expired timers deferred by the running budgeted handleTick() call, unsorted.
+  SpinTimer* m_deferLast; /// Trailing element of the deferred timers.
+  unsigned long m_pendingCount; /// Number of pending and deferred notifications.
+  bool m_isDeferring; /// A budgeted handleTick() call is detecting the expirations, the notifications get deferred.
+#endif
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+  std::atomic<SpinTimer*> m_commands; /// Lock-free stack of the timers having pending commands, latest posted first.
+  SpinTimerDispatcher* m_dispatcher; /// Dispatcher running the actions of the expired timers, 0: none.
+  SpinTimer* m_dispatchFirst; /// Expired timers collected during the running handleTick() call, to be handed over to the dispatcher.
+  SpinTimer* m_dispatchLast; /// Trailing element of the collected expired timers.
+  bool m_isHandlingTick; /// handleTick() is running.
+#endif
+#ifdef SPINTIMER_STATISTICS
+  SpinTimerContextStatistics m_statistics; /// Runtime statistics.
+  unsigned long m_visitedCount; /// Number of timers visited by the running handleTick() call.
+#endif
 
 private: // forbidden default functions
   SpinTimerContext& operator = (const SpinTimerContext& src); // assignment operator
@@ -0,0 +1,448 @@
+/*
+ * SpinTimerCoroutine.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERCOROUTINE_H_
+#define SPINTIMERCOROUTINE_H_
+
+/**
+ * C++20 coroutine support, available if the including translation unit is compiled as C++20 (not on Arduino).
+ *
+ * - SpinTimerTask: return type of a timed sequence coroutine, started right away and destroyed when it completes
+ * - co_await spinDelay(timeMillis): suspends the coroutine, it gets resumed directly from SpinTimerContext::handleTick()
+ * - co_await timer.expired(): suspends the coroutine until the next expiration of a SpinTimerAwaitable
+ * - the coroutines are always resumed by the thread kicking the context, also if the context has a dispatcher
+ *   (@see SpinTimerContext::setDispatcher())
+ * - the coroutine frames are allocated by the SpinTimerFramePool
+ */
+#if (__cplusplus >= 202002L) && !defined(ARDUINO) && defined(__has_include)
+#if __has_include(<coroutine>)
+
+#define SPINTIMER_COROUTINES  /// Coroutine awaitables supported.
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerSleepQueue.h"
+
+/**
+ * Pooled allocator of coroutine frames.
+ *
+ * Features:
+ * - frames are taken from per thread free lists of fixed size blocks (size classes of GRANULARITY bytes), the blocks
+ *   are carved out of chunks allocated BLOCKS_PER_CHUNK at a time; allocating and freeing a frame is O(1) and does not
+ *   touch the heap in the steady state
+ * - frames larger than the largest size class come from the heap
+ * - the chunks are kept for reuse and freed when the thread ends, unless frames are still in use then (i.e. coroutines
+ *   being suspended forever), these chunks are left to the process exit; a frame must be freed by the thread having
+ *   allocated it (the coroutines are resumed by the thread owning their SpinTimerContext)
+ */
+class SpinTimerFramePool
+{
+public:
+  static const std::size_t GRANULARITY = 32;        /// Block size step [bytes].
+  static const unsigned int CLASSES = 16;           /// Number of size classes, blocks up to 512 bytes.
+  static const unsigned int BLOCKS_PER_CHUNK = 64;  /// Number of blocks allocated at a time.
+
+  /**
+   * Allocate a frame.
+   * @param size Frame size [bytes].
+   * @return Frame memory.
+   */
+  static void* allocate(std::size_t size)
+  {
+    unsigned int sizeClass = classOf(size);
+    if (CLASSES <= sizeClass)
+    {
+      return ::operator new(size);
+    }
+    SpinTimerFramePool& pool = local();
+    Block* block = pool.m_free[sizeClass];
+    if (0 == block)
+    {
+      block = pool.refill(sizeClass);
+    }
+    pool.m_free[sizeClass] = block->next;
+    pool.m_inUse++;
+    return block;
+  }
+
+  /**
+   * Free a frame.
+   * @param memory Frame memory.
+   * @param size Frame size [bytes], as passed to allocate().
+   */
+  static void deallocate(void* memory, std::size_t size)
+  {
+    unsigned int sizeClass = classOf(size);
+    if (CLASSES <= sizeClass)
+    {
+      ::operator delete(memory);
+      return;
+    }
+    SpinTimerFramePool& pool = local();
+    Block* block = static_cast<Block*>(memory);
+    block->next = pool.m_free[sizeClass];
+    pool.m_free[sizeClass] = block;
+    pool.m_inUse--;
+  }
+
+  /**
+   * Number of pooled frames in use by the calling thread.
+   * @return Number of frames allocated and not freed yet.
+   */
+  static unsigned long inUse()
+  {
+    return local().m_inUse;
+  }
+
+private:
+  struct Block
+  {
+    Block* next;  /// Next free block of the same size class.
+  };
+
+  struct alignas(GRANULARITY) Chunk
+  {
+    Chunk* next;  /// Next chunk, the blocks follow the chunk header.
+  };
+
+  SpinTimerFramePool()
+  : m_chunks(0)
+  , m_inUse(0)
+  {
+    for (unsigned int i = 0; i < CLASSES; i++)
+    {
+      m_free[i] = 0;
+    }
+  }
+
+  ~SpinTimerFramePool()
+  {
+    if (0 != m_inUse)
+    {
+      // frames of suspended coroutines may still be referenced, i.e. by the sleep queue of a static context being
+      // destroyed after the thread's pool at the process exit; the chunks get leaked
+      return;
+    }
+    while (0 != m_chunks)
+    {
+      Chunk* chunk = m_chunks;
+      m_chunks = chunk->next;
+      ::operator delete(chunk);
+    }
+  }
+
+  static SpinTimerFramePool& local()
+  {
+    static thread_local SpinTimerFramePool pool;
+    return pool;
+  }
+
+  static unsigned int classOf(std::size_t size)
+  {
+    return static_cast<unsigned int>((size + GRANULARITY - 1) / GRANULARITY) - 1;
+  }
+
+  Block* refill(unsigned int sizeClass)
+  {
+    std::size_t blockSize = (sizeClass + 1) * GRANULARITY;
+    Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk) + BLOCKS_PER_CHUNK * blockSize));
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+    unsigned char* blocks = reinterpret_cast<unsigned char*>(chunk) + sizeof(Chunk);
+    for (unsigned int i = 0; i < BLOCKS_PER_CHUNK; i++)
+    {
+      Block* block = reinterpret_cast<Block*>(blocks + i * blockSize);
+      block->next = (i + 1 < BLOCKS_PER_CHUNK) ? reinterpret_cast<Block*>(blocks + (i + 1) * blockSize) : 0;
+    }
+    return reinterpret_cast<Block*>(blocks);
+  }
+
+private:
+  Block* m_free[CLASSES];   /// Free lists, one per size class.
+  Chunk* m_chunks;          /// Allocated chunks.
+  unsigned long m_inUse;    /// Number of pooled frames in use.
+
+private: // forbidden functions
+  SpinTimerFramePool(const SpinTimerFramePool& src);              // copy constructor
+  SpinTimerFramePool& operator = (const SpinTimerFramePool& src); // assignment operator
+};
+
+/**
+ * Return type of a timed sequence coroutine.
+ *
+ * The coroutine starts running right away when being called, runs up to its first co_await and continues each time
+ * the awaited delay or timer expiration has come; its frame gets freed as soon as it completes (fire and forget).
+ *
+ *       SpinTimerTask doubleStrobe()
+ *       {
+ *         for (;;)
+ *         {
+ *           for (int i = 0; i < 3; i++)
+ *           {
+ *             toggleLed();
+ *             co_await spinDelay(200);
+ *           }
+ *           co_await spinDelay(1000);
+ *         }
+ *       }
+ */
+class SpinTimerTask
+{
+public:
+  struct promise_type
+  {
+    SpinTimerTask get_return_object() { return SpinTimerTask(); }
+    std::suspend_never initial_suspend() noexcept { return std::suspend_never(); }
+    std::suspend_never final_suspend() noexcept { return std::suspend_never(); }
+    void return_void() { }
+    void unhandled_exception() { std::terminate(); }
+
+    static void* operator new(std::size_t size) { return SpinTimerFramePool::allocate(size); }
+    static void operator delete(void* memory, std::size_t size) { SpinTimerFramePool::deallocate(memory, size); }
+  };
+};
+
+/**
+ * Awaitable delay, @see spinDelay().
+ */
+class SpinTimerDelay
+{
+public:
+  SpinTimerDelay(SpinTimerTick delayTicks, SpinTimerContext* context)
+  : m_sleeper(&SpinTimerDelay::resume, 0)
+  , m_delayTicks(delayTicks)
+  , m_queue(((0 != context) ? context : SpinTimerContext::current())->sleepQueue())
+  { }
+
+  ~SpinTimerDelay()
+  {
+    m_queue->cancel(&m_sleeper);
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    m_sleeper.arg = handle.address();
+    m_queue->sleep(&m_sleeper, m_delayTicks);
+  }
+
+  void await_resume() const noexcept { }
+
+private:
+  static void resume(void* handle)
+  {
+    std::coroutine_handle<>::from_address(handle).resume();
+  }
+
+private:
+  SpinTimerSleeper m_sleeper;     /// Node kept in the sleep queue, part of the coroutine frame.
+  SpinTimerTick m_delayTicks;     /// Time to sleep [ticks].
+  SpinTimerSleepQueue* m_queue;   /// Sleep queue of the context.
+
+private: // forbidden functions
+  SpinTimerDelay& operator = (const SpinTimerDelay& src); // assignment operator
+};
+
+/**
+ * Suspend the awaiting coroutine for a time, it gets resumed from SpinTimerContext::handleTick().
+ * @param timeMillis Time to sleep [ms]; 0 resumes the coroutine with the next handleTick() call.
+ * @param context SpinTimerContext resuming the coroutine, default: 0 (SpinTimerContext::current())
+ * @return Awaitable.
+ */
+inline SpinTimerDelay spinDelay(unsigned long timeMillis, SpinTimerContext* context = 0)
+{
+  return SpinTimerDelay(static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI, context);
+}
+
+/**
+ * Suspend the awaiting coroutine for a time, it gets resumed from SpinTimerContext::handleTick().
+ * @param timeTicks Time to sleep [ticks]; 0 resumes the coroutine with the next handleTick() call.
+ * @param context SpinTimerContext resuming the coroutine, default: 0 (SpinTimerContext::current())
+ * @return Awaitable.
+ */
+inline SpinTimerDelay spinDelayTicks(SpinTimerTick timeTicks, SpinTimerContext* context = 0)
+{
+  return SpinTimerDelay(timeTicks, context);
+}
+
+/**
+ * Spin Timer resuming the coroutines awaiting its expiration.
+ *
+ * Features:
+ * - co_await expired() suspends the coroutine until the next expiration of the timer, the waiting coroutines are
+ *   resumed in the order they have been suspended
+ * - all the other SpinTimer features are available, the timer is controlled as usual (i.e. by another coroutine)
+ * - the timer must outlive the coroutines awaiting it
+ *
+ * Integration:
+ *
+ *       SpinTimerAwaitable heartbeat(1000, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+ *
+ *       SpinTimerTask monitor()
+ *       {
+ *         for (;;)
+ *         {
+ *           co_await heartbeat.expired();
+ *           // ..
+ *         }
+ *       }
+ */
+class SpinTimerAwaitable : public SpinTimer
+{
+public:
+  /**
+   * Awaitable expiration, @see expired().
+   */
+  class Expiry
+  {
+    friend class SpinTimerAwaitable;
+
+  public:
+    Expiry(SpinTimerAwaitable& timer)
+    : m_timer(timer)
+    , m_next(0)
+    , m_isWaiting(false)
+    { }
+
+    ~Expiry()
+    {
+      if (m_isWaiting)
+      {
+        m_timer.remove(this);
+      }
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+      m_handle = handle;
+      m_timer.append(this);
+    }
+
+    void await_resume() const noexcept { }
+
+  private:
+    SpinTimerAwaitable& m_timer;       /// Awaited timer.
+    std::coroutine_handle<> m_handle;  /// Suspended coroutine.
+    Expiry* m_next;                    /// Next waiting coroutine.
+    bool m_isWaiting;                  /// Kept in the timer's waiting list.
+
+  private: // forbidden functions
+    Expiry& operator = (const Expiry& src); // assignment operator
+  };
+
+  /**
+   * Timer constructor.
+   * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
+   * @param isRecurring Operation mode, true: recurring, false: non-recurring, default: false
+   * @param isAutostart Autostart mode, true: autostart enabled, false: autostart disabled, default: false
+   * @param context SpinTimerContext the timer attaches to, default: 0 (SpinTimerContext::current())
+   */
+  SpinTimerAwaitable(unsigned long timeMillis, bool isRecurring = false, bool isAutostart = false, SpinTimerContext* context = 0)
+  : SpinTimer(timeMillis, 0, isRecurring, IS_NON_AUTOSTART, context)
+  , m_first(0)
+  , m_last(0)
+  {
+    attachCallback(&SpinTimerAwaitable::timeExpired);
+    bypassDispatcher();
+    if (isAutostart)
+    {
+      start();
+    }
+  }
+
+  /**
+   * Timer destructor.
+   * Waits for a command posted by another thread being applied, before the waiting list gets destroyed.
+   */
+  virtual ~SpinTimerAwaitable()
+  {
+    quiesce();
+  }
+
+  /**
+   * Await the next expiration of the timer.
+   * @return Awaitable.
+   */
+  Expiry expired()
+  {
+    return Expiry(*this);
+  }
+
+private:
+  static void timeExpired(SpinTimer* timer)
+  {
+    SpinTimerAwaitable* self = static_cast<SpinTimerAwaitable*>(timer);
+
+    // coroutines awaiting the timer again get resumed by the next expiration
+    Expiry* waiting = self->m_first;
+    self->m_first = 0;
+    self->m_last = 0;
+    while (0 != waiting)
+    {
+      Expiry* expiry = waiting;
+      waiting = expiry->m_next;
+      expiry->m_next = 0;
+      expiry->m_isWaiting = false;
+      expiry->m_handle.resume();
+    }
+  }
+
+  void append(Expiry* expiry)
+  {
+    expiry->m_isWaiting = true;
+    if (0 == m_last)
+    {
+      m_first = expiry;
+    }
+    else
+    {
+      m_last->m_next = expiry;
+    }
+    m_last = expiry;
+  }
+
+  void remove(Expiry* expiry)
+  {
+    Expiry* prev = 0;
+    for (Expiry* it = m_first; 0 != it; prev = it, it = it->m_next)
+    {
+      if (expiry == it)
+      {
+        if (0 == prev)
+        {
+          m_first = it->m_next;
+        }
+        else
+        {
+          prev->m_next = it->m_next;
+        }
+        if (m_last == it)
+        {
+          m_last = prev;
+        }
+        break;
+      }
+    }
+    expiry->m_isWaiting = false;
+  }
+
+private:
+  Expiry* m_first;  /// First coroutine awaiting the expiration.
+  Expiry* m_last;   /// Last coroutine awaiting the expiration.
+};
+
+#endif
+#endif
+
+#endif /* SPINTIMERCOROUTINE_H_ */
@@ -0,0 +1,70 @@
+/*
+ * SpinTimerDispatcher.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERDISPATCHER_H_
+#define SPINTIMERDISPATCHER_H_
+
+#include "SpinTimer.h"
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+
+/**
+ * Dispatcher Interface, runs the actions of expired SpinTimer objects outside of the thread kicking their context.
+ *
+ * By default the SpinTimer objects call their action's SpinTimerAction::timeExpired() method inline, so a slow action
+ * delays all the timers being evaluated later in the same SpinTimerContext::handleTick() pass.
+ * Implementations derived from this interface can be injected into the SpinTimerContext
+ * (@see SpinTimerContext::setDispatcher()): the context collects the expired timers during the pass and hands them over
+ * to the dispatcher afterwards, which has to call run() for each of them, i.e. on a worker thread (@see SpinTimerWorkerPool).
+ * Only available if SPINTIMER_CROSS_THREAD_CONTROL is defined.
+ *
+ * The actions of one timer never run concurrently and are run in the order of the expirations: a timer is handed over
+ * to the dispatcher once, further expirations until run() has finished are executed by this very run() call.
+ */
+class SpinTimerDispatcher
+{
+public:
+  /**
+   * Hand over a list of expired SpinTimer objects, called by the thread kicking the context.
+   * @param timers First timer of the list, linked with next(timer), the last one links to 0.
+   */
+  virtual void dispatch(SpinTimer* timers) = 0;
+
+protected:
+  SpinTimerDispatcher() { }
+
+public:
+  virtual ~SpinTimerDispatcher() { }
+
+protected:
+  /**
+   * Run the pending time expired events of a SpinTimer object's action.
+   * @param timer SpinTimer object pointer, handed over with dispatch().
+   */
+  static inline void run(SpinTimer* timer)
+  {
+    timer->runDispatched();
+  }
+
+  /**
+   * Next timer of a list handed over with dispatch().
+   * @param timer SpinTimer object pointer.
+   * @return Next SpinTimer object pointer, 0 if timer is the last one of the list.
+   */
+  static inline SpinTimer* next(const SpinTimer* timer)
+  {
+    return timer->m_dispatchNext;
+  }
+
+private: // forbidden functions
+  SpinTimerDispatcher(const SpinTimerDispatcher& src);              // copy constructor
+  SpinTimerDispatcher& operator = (const SpinTimerDispatcher& src); // assignment operator
+};
+
+#endif
+
+#endif /* SPINTIMERDISPATCHER_H_ */
@@ -0,0 +1,158 @@
+/*
+ * SpinTimerEngine.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERENGINE_H_
+#define SPINTIMERENGINE_H_
+
+#include <limits.h>
+#include "SpinTimer.h"
+
+/**
+ * Engine Interface, keeps track of the running SpinTimer objects of a SpinTimerContext and dispatches
+ * the expired ones.
+ *
+ * By default the SpinTimerContext kicks every attached SpinTimer on each SpinTimerContext::handleTick() call.
+ * Implementations derived from this interface can be injected into the SpinTimerContext
+ * (@see SpinTimerContext::setEngine()) in order to only visit the timers whose time has come.
+ *
+ * The SpinTimerContext notifies the engine whenever a timer gets (re-)started (schedule()) or stopped,
+ * cancelled or detached (unschedule()). The engine may use the link members of the SpinTimer objects
+ * (engineNext(), enginePrev(), engineChild(), engineTag()) for its own book keeping.
+ */
+class SpinTimerEngine
+{
+public:
+  /**
+   * Prepare the engine to get engaged by a SpinTimerContext, sets the engine's time base.
+   * All timers being scheduled at this point will be discarded.
+   * @param nowTicks Current up-time [ticks].
+   */
+  virtual void reset(SpinTimerTick nowTicks) = 0;
+
+  /**
+   * Add a running SpinTimer or re-position an already scheduled one according to its new expiration time.
+   * @param timer SpinTimer object pointer.
+   */
+  virtual void schedule(SpinTimer* timer) = 0;
+
+  /**
+   * Remove a SpinTimer, does nothing if the timer is not scheduled.
+   * @param timer SpinTimer object pointer.
+   */
+  virtual void unschedule(SpinTimer* timer) = 0;
+
+  /**
+   * Dispatch all the scheduled timers having expired up to now.
+   * @param nowTicks Current up-time [ticks].
+   */
+  virtual void handleTick(SpinTimerTick nowTicks) = 0;
+
+  /**
+   * Time left until the earliest scheduled timer expires; a lower bound is acceptable, the result must never be late.
+   * @param nowTicks Current up-time [ticks].
+   * @return Time left [ticks], 0 if a timer is due already, SpinTimerContext::NO_EXPIRY_TICKS if no timer is scheduled.
+   */
+  virtual SpinTimerTick nextExpiryTicks(SpinTimerTick nowTicks) = 0;
+
+protected:
+  SpinTimerEngine() { }
+
+public:
+  virtual ~SpinTimerEngine() { }
+
+protected:
+  /**
+   * Calculate the time left until the timer's interval is over, seen from a specific point in time.
+   * @see SpinTimer::remainingTicks()
+   * @param timer SpinTimer object pointer.
+   * @param baseTicks Point in time the remaining time is related to [ticks].
+   * @return Time left [ticks], 0 if the interval is over.
+   */
+  static inline SpinTimerTick remainingTicks(const SpinTimer* timer, SpinTimerTick baseTicks)
+  {
+    return timer->remainingTicks(baseTicks);
+  }
+
+  /**
+   * Let the timer expire, restarts a recurring timer (which leads to a new schedule() call) and emits the time expired event.
+   * @param timer SpinTimer object pointer, must not be scheduled in the engine anymore.
+   * @param nowTicks Current up-time [ticks].
+   */
+  static inline void expire(SpinTimer* timer, SpinTimerTick nowTicks)
+  {
+    timer->m_currentTimeTicks = nowTicks;
+    timer->expire();
+  }
+
+  /**
+   * Append a timer to a circular doubly linked list made of the engine links.
+   * @param head List head, 0 if the list is empty.
+   * @param timer SpinTimer object pointer, must not be linked yet.
+   * @param tag Engine specific location tag to be assigned to the timer.
+   */
+  static inline void listAppend(SpinTimer*& head, SpinTimer* timer, unsigned int tag)
+  {
+    if (0 == head)
+    {
+      timer->m_engineNext = timer;
+      timer->m_enginePrev = timer;
+      head = timer;
+    }
+    else
+    {
+      SpinTimer* tail = head->m_enginePrev;
+      timer->m_engineNext = head;
+      timer->m_enginePrev = tail;
+      tail->m_engineNext = timer;
+      head->m_enginePrev = timer;
+    }
+    timer->m_engineTag = tag;
+  }
+
+  /**
+   * Remove a timer from a circular doubly linked list made of the engine links, resets the timer's tag.
+   * @param head List head.
+   * @param timer SpinTimer object pointer, must be an element of the list.
+   */
+  static inline void listRemove(SpinTimer*& head, SpinTimer* timer)
+  {
+    if (timer->m_engineNext == timer)
+    {
+      head = 0;
+    }
+    else
+    {
+      timer->m_enginePrev->m_engineNext = timer->m_engineNext;
+      timer->m_engineNext->m_enginePrev = timer->m_enginePrev;
+      if (head == timer)
+      {
+        head = timer->m_engineNext;
+      }
+    }
+    timer->m_engineNext = 0;
+    timer->m_enginePrev = 0;
+    timer->m_engineTag = 0;
+  }
+
+  static inline SpinTimer*& engineNext(SpinTimer* timer)   { return timer->m_engineNext; }
+  static inline SpinTimer*& enginePrev(SpinTimer* timer)   { return timer->m_enginePrev; }
+  static inline SpinTimer*& engineChild(SpinTimer* timer)  { return timer->m_engineChild; }
+  static inline unsigned int& engineTag(SpinTimer* timer)  { return timer->m_engineTag; }
+
+  /**
+   * Up-time the timer has been evaluated the last time, i.e. when it has been (re-)started.
+   * @param timer SpinTimer object pointer.
+   * @return Up-time [ticks].
+   */
+  static inline SpinTimerTick currentTicks(const SpinTimer* timer) { return timer->m_currentTimeTicks; }
+
+private: // forbidden functions
+  SpinTimerEngine(const SpinTimerEngine& src);              // copy constructor
+  SpinTimerEngine& operator = (const SpinTimerEngine& src); // assignment operator
+};
+
+#endif /* SPINTIMERENGINE_H_ */
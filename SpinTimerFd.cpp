@@ -0,0 +1,66 @@
+/*
+ * SpinTimerFd.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerFd.h"
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+#include "SpinTimerContext.h"
+
+SpinTimerFd::SpinTimerFd(SpinTimerContext* context)
+: m_context((0 != context) ? context : SpinTimerContext::current())
+, m_fd(timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
+{
+  rearm();
+}
+
+SpinTimerFd::~SpinTimerFd()
+{
+  if (m_fd >= 0)
+  {
+    close(m_fd);
+  }
+}
+
+int SpinTimerFd::fd() const
+{
+  return m_fd;
+}
+
+void SpinTimerFd::handleEvent()
+{
+  uint64_t expirations = 0;
+  while (read(m_fd, &expirations, sizeof(expirations)) > 0)
+  { }
+
+  m_context->handleTick();
+  rearm();
+}
+
+void SpinTimerFd::rearm()
+{
+  if (m_fd < 0)
+  {
+    return;
+  }
+
+  struct itimerspec spec = { };
+  SpinTimerTick nextTicks = m_context->nextExpiryTicks();
+  if (SpinTimerContext::NO_EXPIRY_TICKS != nextTicks)
+  {
+    // a zero it_value would disarm the timer, fire as soon as possible instead
+    const SpinTimerTick ticksPerSecond = SPINTIMER_TICKS_PER_MILLI * 1000;
+    spec.it_value.tv_sec  = nextTicks / ticksPerSecond;
+    spec.it_value.tv_nsec = (0 == nextTicks) ? 1 : (nextTicks % ticksPerSecond) * (1000000L / SPINTIMER_TICKS_PER_MILLI);
+  }
+  timerfd_settime(m_fd, 0, &spec, 0);
+}
+
+#endif
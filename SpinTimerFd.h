@@ -0,0 +1,91 @@
+/*
+ * SpinTimerFd.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERFD_H_
+#define SPINTIMERFD_H_
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+class SpinTimerContext;
+
+/**
+ * Linux event loop integration of the SpinTimerContext.
+ *
+ * Features:
+ * - exposes a single pollable file descriptor (timerfd), armed to the expiration time of the earliest running timer
+ *   (@see SpinTimerContext::nextExpiryMillis()), to be added to an external epoll / poll / select loop
+ * - handleEvent() kicks the timers and re-arms the file descriptor, so the loop wakes up exactly when a timer is due
+ *   and never polls while no timer is running
+ *
+ * Integration:
+ *
+ *       SpinTimerFd timerFd;
+ *
+ *       struct epoll_event event;
+ *       event.events = EPOLLIN;
+ *       event.data.fd = timerFd.fd();
+ *       epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd.fd(), &event);
+ *
+ *       for (;;)
+ *       {
+ *         int count = epoll_wait(epollFd, events, MAX_EVENTS, -1);
+ *         for (int i = 0; i < count; i++)
+ *         {
+ *           if (events[i].data.fd == timerFd.fd())
+ *           {
+ *             timerFd.handleEvent();
+ *           }
+ *           // .. handle the other file descriptors, might start or cancel timers
+ *         }
+ *         timerFd.rearm();
+ *       }
+ *
+ * Timers started outside of handleEvent() (i.e. by the other event handlers) are only taken into account
+ * after the next rearm() call.
+ */
+class SpinTimerFd
+{
+public:
+  /**
+   * Constructor, creates and arms the timer file descriptor.
+   * @param context SpinTimerContext whose timers are handled, default: 0 (SpinTimerContext::current())
+   */
+  SpinTimerFd(SpinTimerContext* context = 0);
+
+  /**
+   * Destructor, closes the timer file descriptor.
+   */
+  virtual ~SpinTimerFd();
+
+  /**
+   * Pollable file descriptor, becomes readable when the earliest running timer is due.
+   * @return File descriptor, -1 if the timerfd could not be created.
+   */
+  int fd() const;
+
+  /**
+   * Acknowledge the file descriptor event, kick the timers (SpinTimerContext::handleTick()) and re-arm.
+   */
+  void handleEvent();
+
+  /**
+   * Arm the file descriptor to the expiration time of the earliest running timer, disarm it if no timer is running.
+   */
+  void rearm();
+
+private:
+  SpinTimerContext* m_context;  /// Context whose timers are handled.
+  int m_fd;                     /// Timer file descriptor.
+
+private: // forbidden functions
+  SpinTimerFd(const SpinTimerFd& src);              // copy constructor
+  SpinTimerFd& operator = (const SpinTimerFd& src); // assignment operator
+};
+
+#endif
+
+#endif /* SPINTIMERFD_H_ */
@@ -0,0 +1,242 @@
+/*
+ * SpinTimerGroup.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerGroup.h"
+
+#ifdef SPINTIMER_GROUPS
+
+#include "UptimeInfo.h"
+
+SpinTimerGroup::SpinTimerGroup()
+: m_first(0)
+, m_size(0)
+, m_generation(0)
+, m_shiftTicks(0)
+, m_pauseTicks(0)
+, m_isPaused(false)
+{ }
+
+SpinTimerGroup::~SpinTimerGroup()
+{
+  while (0 != m_first)
+  {
+    remove(m_first);
+  }
+}
+
+void SpinTimerGroup::add(SpinTimer* timer)
+{
+  if (this == timer->m_group)
+  {
+    return;
+  }
+  if (0 != timer->m_group)
+  {
+    timer->m_group->remove(timer);
+  }
+
+  timer->m_groupPrev = 0;
+  timer->m_groupNext = m_first;
+  if (0 != m_first)
+  {
+    m_first->m_groupPrev = timer;
+  }
+  m_first = timer;
+  m_size++;
+  timer->m_group = this;
+
+  // a running timer keeps its deadline, only the pauses from now on count
+  sync(timer, UptimeInfo::Instance()->tTicks());
+}
+
+void SpinTimerGroup::remove(SpinTimer* timer)
+{
+  settle(timer, UptimeInfo::Instance()->tTicks());
+  unlink(timer);
+}
+
+unsigned int SpinTimerGroup::size() const
+{
+  return m_size;
+}
+
+void SpinTimerGroup::start()
+{
+  for (SpinTimer* timer = m_first; 0 != timer; timer = timer->m_groupNext)
+  {
+    timer->start();
+  }
+}
+
+void SpinTimerGroup::start(unsigned long timeMillis)
+{
+  startTicks(static_cast<SpinTimerTick>(timeMillis) * SPINTIMER_TICKS_PER_MILLI);
+}
+
+void SpinTimerGroup::startTicks(SpinTimerTick timeTicks)
+{
+  for (SpinTimer* timer = m_first; 0 != timer; timer = timer->m_groupNext)
+  {
+    timer->startTicks(timeTicks);
+  }
+}
+
+void SpinTimerGroup::cancel()
+{
+  // the members started before are stale from now on, @see intercept()
+  m_generation++;
+}
+
+void SpinTimerGroup::pause()
+{
+  if (!m_isPaused)
+  {
+    m_isPaused = true;
+    m_pauseTicks = UptimeInfo::Instance()->tTicks();
+  }
+}
+
+void SpinTimerGroup::resume()
+{
+  if (!m_isPaused)
+  {
+    return;
+  }
+  SpinTimerTick nowTicks = UptimeInfo::Instance()->tTicks();
+  m_shiftTicks += nowTicks - m_pauseTicks;
+  m_isPaused = false;
+
+  // the parked members are scheduled again, the others get shifted when their previous deadline comes up
+  for (SpinTimer* timer = m_first; 0 != timer; timer = timer->m_groupNext)
+  {
+    if (timer->m_isParked)
+    {
+      settle(timer, nowTicks);
+    }
+  }
+}
+
+bool SpinTimerGroup::isPaused() const
+{
+  return m_isPaused;
+}
+
+bool SpinTimerGroup::intercept(SpinTimer* timer)
+{
+  if (timer->m_groupGeneration != m_generation)
+  {
+    // cancelled by the group
+    stop(timer);
+    return true;
+  }
+
+  if (m_isPaused)
+  {
+    if (!timer->m_isParked)
+    {
+      // kept out of the engine until resume()
+      timer->m_isParked = true;
+      timer->m_context->unschedule(timer);
+    }
+    return true;
+  }
+
+  SpinTimerTick shiftTicks = m_shiftTicks - timer->m_groupShiftTicks;
+  if (0 != shiftTicks)
+  {
+    // the group has been paused meanwhile, the deadline moves by the time paused
+    timer->m_groupShiftTicks = m_shiftTicks;
+    timer->m_triggerTimeTicks += shiftTicks;
+#ifdef SPINTIMER_LAZY_RESTART
+    timer->m_rearmTicks += shiftTicks;
+#endif
+    if (!timer->isIntervalOver())
+    {
+      timer->m_context->schedule(timer);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SpinTimerGroup::isSynced(const SpinTimer* timer) const
+{
+  return !timer->m_isParked && !m_isPaused &&
+         (timer->m_groupGeneration == m_generation) &&
+         (timer->m_groupShiftTicks == m_shiftTicks);
+}
+
+void SpinTimerGroup::sync(SpinTimer* timer, SpinTimerTick currentTimeTicks)
+{
+  timer->m_groupGeneration = m_generation;
+  timer->m_groupShiftTicks = m_shiftTicks + (m_isPaused ? currentTimeTicks - m_pauseTicks : 0);
+  timer->m_isParked = false;
+}
+
+void SpinTimerGroup::settle(SpinTimer* timer, SpinTimerTick currentTimeTicks)
+{
+  if (!timer->m_isRunning)
+  {
+    timer->m_isParked = false;
+    return;
+  }
+  if (timer->m_groupGeneration != m_generation)
+  {
+    stop(timer);
+    return;
+  }
+
+  SpinTimerTick shiftTicks = pendingShiftTicks(timer, currentTimeTicks);
+  timer->m_groupShiftTicks += shiftTicks;
+  if ((0 != shiftTicks) || timer->m_isParked)
+  {
+    timer->m_triggerTimeTicks += shiftTicks;
+#ifdef SPINTIMER_LAZY_RESTART
+    timer->m_rearmTicks += shiftTicks;
+#endif
+    timer->m_isParked = false;
+    timer->m_currentTimeTicks = currentTimeTicks;
+    timer->m_context->schedule(timer);
+  }
+}
+
+SpinTimerTick SpinTimerGroup::pendingShiftTicks(const SpinTimer* timer, SpinTimerTick currentTimeTicks) const
+{
+  return m_shiftTicks + (m_isPaused ? currentTimeTicks - m_pauseTicks : 0) - timer->m_groupShiftTicks;
+}
+
+void SpinTimerGroup::stop(SpinTimer* timer)
+{
+  timer->m_isRunning = false;
+#ifdef SPINTIMER_LAZY_RESTART
+  timer->m_isRearmPending = false;
+#endif
+  timer->m_isParked = false;
+  timer->m_context->unschedule(timer);
+}
+
+void SpinTimerGroup::unlink(SpinTimer* timer)
+{
+  if (0 == timer->m_groupPrev)
+  {
+    m_first = timer->m_groupNext;
+  }
+  else
+  {
+    timer->m_groupPrev->m_groupNext = timer->m_groupNext;
+  }
+  if (0 != timer->m_groupNext)
+  {
+    timer->m_groupNext->m_groupPrev = timer->m_groupPrev;
+  }
+  timer->m_groupNext = 0;
+  timer->m_groupPrev = 0;
+  timer->m_group = 0;
+  m_size--;
+}
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * SpinTimerGroup.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERGROUP_H_
+#define SPINTIMERGROUP_H_
+
+#include "SpinTimer.h"
+
+/**
+ * Timer group configuration, selected at compile time.
+ *
+ * - default: no groups, the SpinTimer objects do not carry any group membership
+ * - SPINTIMER_GROUPS defined: SpinTimerGroup is available, each SpinTimer keeps its group membership (@see
+ *   SpinTimer::group()); the CMake build provides the SpinTimerGroups library variant
+ */
+#ifdef SPINTIMER_GROUPS
+
+/**
+ * Set of timers controlled together, i.e. all the time outs of a connection or all the blink timers of a board.
+ *
+ * Features:
+ * - cancel() and pause() are O(1), no matter how many timers the group has: the group counts a generation up or
+ *   sets its paused flag, and the member timers are taken out of their context's engine lazily, when their deadlines
+ *   come up (the same way SpinTimer::restart() re-arms lazily); a member cancelled by its group is not running anymore
+ *   right away (@see SpinTimer::isRunning()) and does not emit any time expired event
+ * - resume() shifts the deadlines of all member timers by the time the group has been paused; the ones being parked
+ *   (their deadline came up while paused) are scheduled again, the others get shifted when their previous deadline
+ *   comes up
+ * - start(), start(timeMillis) and startTicks() (re-interval) start or restart all the member timers
+ * - add() and remove() are O(1), the members are kept in an intrusive list; a timer is member of one group at most
+ * - the member timers must be attached to contexts kicked by the thread controlling the group; a group is not
+ *   thread safe
+ *
+ * Integration:
+ *
+ *       SpinTimerGroup peerTimers;
+ *       peerTimers.add(&keepAliveTimer);
+ *       peerTimers.add(&responseTimer);
+ *       // ..
+ *       peerTimers.cancel();  // connection closed
+ */
+class SpinTimerGroup
+{
+  friend class SpinTimer;
+
+public:
+  /**
+   * Constructor, creates an empty group not being paused.
+   */
+  SpinTimerGroup();
+
+  /**
+   * Destructor, the member timers leave the group (@see remove()).
+   */
+  virtual ~SpinTimerGroup();
+
+  /**
+   * Add a timer to the group, the timer leaves its previous group if any. A running timer keeps running.
+   * @param timer SpinTimer object pointer.
+   */
+  void add(SpinTimer* timer);
+
+  /**
+   * Remove a timer from the group. A timer cancelled by the group stays stopped, a paused one continues with its
+   * remaining time.
+   * @param timer SpinTimer object pointer, must be member of this group.
+   */
+  void remove(SpinTimer* timer);
+
+  /**
+   * Number of member timers.
+   * @return Number of timers added and not removed yet.
+   */
+  unsigned int size() const;
+
+  /**
+   * Start or restart all the member timers, @see SpinTimer::start().
+   */
+  void start();
+
+  /**
+   * Start or restart all the member timers with a new time out or interval time, @see SpinTimer::start(unsigned long timeMillis).
+   * @param timeMillis Time out or interval time to be set for the timers [ms].
+   */
+  void start(unsigned long timeMillis);
+
+  /**
+   * Start or restart all the member timers with a new time out or interval time in the configured time base
+   * resolution, @see SpinTimer::startTicks().
+   * @param timeTicks Time out or interval time to be set for the timers [ticks].
+   */
+  void startTicks(SpinTimerTick timeTicks);
+
+  /**
+   * Cancel all the member timers, O(1). No time expired event will be sent out by any of them until they get started
+   * again. A member's expiration flag set before may still be fetched.
+   */
+  void cancel();
+
+  /**
+   * Pause all the member timers, O(1). The time passing while the group is paused does not count for the members'
+   * intervals; a member timer started while paused starts counting with resume().
+   */
+  void pause();
+
+  /**
+   * Resume all the member timers paused by pause(), their deadlines are shifted by the time paused.
+   */
+  void resume();
+
+  /**
+   * Indicates whether the group is paused.
+   * @return true if paused.
+   */
+  bool isPaused() const;
+
+private:
+  /**
+   * Handle a member timer whose deadline came up, called by SpinTimer::expire().
+   * Stops a timer cancelled by the group, parks it while the group is paused and applies the shift caused by the
+   * pauses since it has been synced.
+   * @param timer Member timer, its current time is set.
+   * @return true if the expiration has been handled, false if the timer has expired indeed.
+   */
+  bool intercept(SpinTimer* timer);
+
+  /**
+   * Indicates whether a running member timer is up to date with the group state, i.e. it can be re-armed lazily.
+   * @param timer Member timer.
+   * @return true if the timer has neither been cancelled nor paused nor shifted since it has been synced.
+   */
+  bool isSynced(const SpinTimer* timer) const;
+
+  /**
+   * Take over the group state into a member timer being started.
+   * @param timer Member timer.
+   * @param currentTimeTicks Start time [ticks].
+   */
+  void sync(SpinTimer* timer, SpinTimerTick currentTimeTicks);
+
+  /**
+   * Catch up a member timer with the group state: stop it if cancelled, shift its deadline and re-schedule it.
+   * @param timer Member timer.
+   * @param currentTimeTicks Current up-time [ticks].
+   */
+  void settle(SpinTimer* timer, SpinTimerTick currentTimeTicks);
+
+  /**
+   * Shift a member timer is due, i.e. the pauses since it has been synced, including the running one.
+   * @param timer Member timer.
+   * @param currentTimeTicks Current up-time [ticks].
+   * @return Shift [ticks].
+   */
+  SpinTimerTick pendingShiftTicks(const SpinTimer* timer, SpinTimerTick currentTimeTicks) const;
+
+  /**
+   * Stop a member timer cancelled by the group.
+   * @param timer Member timer.
+   */
+  static void stop(SpinTimer* timer);
+
+  /**
+   * Take a timer out of the member list.
+   * @param timer Member timer.
+   */
+  void unlink(SpinTimer* timer);
+
+private:
+  SpinTimer* m_first;           /// First member timer, 0: group is empty.
+  unsigned int m_size;          /// Number of member timers.
+  unsigned long m_generation;   /// Counted up by cancel(), members started before are cancelled.
+  SpinTimerTick m_shiftTicks;   /// Accumulated time of the finished pauses [ticks].
+  SpinTimerTick m_pauseTicks;   /// Start of the running pause [ticks].
+  bool m_isPaused;              /// Group is paused.
+
+private: // forbidden functions
+  SpinTimerGroup(const SpinTimerGroup& src);              // copy constructor
+  SpinTimerGroup& operator = (const SpinTimerGroup& src); // assignment operator
+};
+
+#endif
+
+#endif /* SPINTIMERGROUP_H_ */
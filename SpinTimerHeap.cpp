@@ -0,0 +1,198 @@
+/*
+ * SpinTimerHeap.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerHeap.h"
+#include "SpinTimerContext.h"
+
+const unsigned int SpinTimerHeap::TAG_QUEUED;
+const unsigned int SpinTimerHeap::TAG_EXPIRED;
+
+SpinTimerHeap::SpinTimerHeap()
+: m_baseTicks(0)
+, m_rootLeftTicks(SPINTIMER_TICK_MAX)
+, m_root(0)
+, m_expired(0)
+{ }
+
+SpinTimerHeap::~SpinTimerHeap()
+{ }
+
+void SpinTimerHeap::reset(SpinTimerTick nowTicks)
+{
+  m_baseTicks = nowTicks;
+  m_rootLeftTicks = SPINTIMER_TICK_MAX;
+  m_root = 0;
+  m_expired = 0;
+}
+
+void SpinTimerHeap::schedule(SpinTimer* timer)
+{
+  unschedule(timer);
+
+  if (0 == m_root)
+  {
+    // nothing to keep the order for, relate to the time the timer has been started
+    m_baseTicks = currentTicks(timer);
+  }
+  engineTag(timer) = TAG_QUEUED;
+  m_root = meld(m_root, timer);
+  updateRootLeftTicks();
+}
+
+void SpinTimerHeap::unschedule(SpinTimer* timer)
+{
+  unsigned int tag = engineTag(timer);
+  if (TAG_EXPIRED == tag)
+  {
+    listRemove(m_expired, timer);
+  }
+  else if (TAG_QUEUED == tag)
+  {
+    if (m_root == timer)
+    {
+      pop();
+    }
+    else
+    {
+      // cut the timer's sub heap, enginePrev() is either the parent or the left sibling
+      if (engineChild(enginePrev(timer)) == timer)
+      {
+        engineChild(enginePrev(timer)) = engineNext(timer);
+      }
+      else
+      {
+        engineNext(enginePrev(timer)) = engineNext(timer);
+      }
+      if (0 != engineNext(timer))
+      {
+        enginePrev(engineNext(timer)) = enginePrev(timer);
+      }
+      SpinTimer* children = engineChild(timer);
+      engineNext(timer) = 0;
+      enginePrev(timer) = 0;
+      engineChild(timer) = 0;
+      engineTag(timer) = 0;
+      m_root = meld(m_root, mergePairs(children));
+    }
+    updateRootLeftTicks();
+  }
+}
+
+void SpinTimerHeap::handleTick(SpinTimerTick nowTicks)
+{
+  SpinTimerTick elapsedTicks = nowTicks - m_baseTicks;
+  if (elapsedTicks < m_rootLeftTicks)
+  {
+    // nothing is due
+    return;
+  }
+
+  // collect the due timers in the order of their expiration times
+  while ((0 != m_root) && (remainingTicks(m_root, m_baseTicks) <= elapsedTicks))
+  {
+    listAppend(m_expired, pop(), TAG_EXPIRED);
+  }
+
+  // all the timers left in the heap expire after nowTicks, their order is kept when relating to nowTicks
+  m_baseTicks = nowTicks;
+  updateRootLeftTicks();
+
+  // dispatch, a recurring timer will be re-scheduled relative to nowTicks
+  while (0 != m_expired)
+  {
+    SpinTimer* timer = m_expired;
+    listRemove(m_expired, timer);
+    expire(timer, nowTicks);
+  }
+}
+
+SpinTimerTick SpinTimerHeap::nextExpiryTicks(SpinTimerTick nowTicks)
+{
+  if (0 != m_expired)
+  {
+    return 0;
+  }
+  return (0 != m_root) ? remainingTicks(m_root, nowTicks) : SpinTimerContext::NO_EXPIRY_TICKS;
+}
+
+SpinTimer* SpinTimerHeap::meld(SpinTimer* a, SpinTimer* b)
+{
+  if (0 == a)
+  {
+    return b;
+  }
+  if (0 == b)
+  {
+    return a;
+  }
+  if (remainingTicks(b, m_baseTicks) < remainingTicks(a, m_baseTicks))
+  {
+    SpinTimer* tmp = a;
+    a = b;
+    b = tmp;
+  }
+
+  // b becomes the leftmost child of a
+  engineNext(b) = engineChild(a);
+  if (0 != engineChild(a))
+  {
+    enginePrev(engineChild(a)) = b;
+  }
+  enginePrev(b) = a;
+  engineChild(a) = b;
+  return a;
+}
+
+SpinTimer* SpinTimerHeap::mergePairs(SpinTimer* first)
+{
+  // first pass: meld the siblings pairwise from left to right, stack the results
+  SpinTimer* stack = 0;
+  while (0 != first)
+  {
+    SpinTimer* a = first;
+    SpinTimer* b = engineNext(a);
+    first = (0 != b) ? engineNext(b) : 0;
+
+    engineNext(a) = 0;
+    enginePrev(a) = 0;
+    if (0 != b)
+    {
+      engineNext(b) = 0;
+      enginePrev(b) = 0;
+    }
+    a = meld(a, b);
+    engineNext(a) = stack;
+    stack = a;
+  }
+
+  // second pass: meld the stacked heaps from right to left
+  SpinTimer* root = 0;
+  while (0 != stack)
+  {
+    SpinTimer* next = engineNext(stack);
+    engineNext(stack) = 0;
+    root = meld(root, stack);
+    stack = next;
+  }
+  return root;
+}
+
+SpinTimer* SpinTimerHeap::pop()
+{
+  SpinTimer* timer = m_root;
+  m_root = mergePairs(engineChild(timer));
+  engineChild(timer) = 0;
+  engineNext(timer) = 0;
+  enginePrev(timer) = 0;
+  engineTag(timer) = 0;
+  return timer;
+}
+
+void SpinTimerHeap::updateRootLeftTicks()
+{
+  m_rootLeftTicks = (0 != m_root) ? remainingTicks(m_root, m_baseTicks) : SPINTIMER_TICK_MAX;
+}
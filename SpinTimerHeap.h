@@ -0,0 +1,90 @@
+/*
+ * SpinTimerHeap.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERHEAP_H_
+#define SPINTIMERHEAP_H_
+
+#include "SpinTimerEngine.h"
+
+/**
+ * Deadline ordered timer queue, SpinTimerEngine implementation.
+ *
+ * Features:
+ * - running timers are kept in an intrusive pairing heap ordered by their expiration time,
+ *   no memory gets allocated
+ * - handleTick() compares the current time against the earliest expiration time only and returns immediately
+ *   when nothing is due, expired timers are dispatched in the order of their expiration times
+ * - start and cancel are O(log n) amortized, the earliest expiration time is known in O(1)
+ * - handles time base overflows correctly, the expiration times are kept relative to the time of
+ *   the last dispatch
+ *
+ * Integration:
+ *
+ *       SpinTimerContext::instance()->setEngine(new SpinTimerHeap());
+ */
+class SpinTimerHeap : public SpinTimerEngine
+{
+public:
+  /**
+   * Constructor.
+   */
+  SpinTimerHeap();
+
+  /**
+   * Destructor.
+   */
+  virtual ~SpinTimerHeap();
+
+  // SpinTimerEngine interface
+  void reset(SpinTimerTick nowTicks);
+  void schedule(SpinTimer* timer);
+  void unschedule(SpinTimer* timer);
+  void handleTick(SpinTimerTick nowTicks);
+  SpinTimerTick nextExpiryTicks(SpinTimerTick nowTicks);
+
+private:
+  /**
+   * Merge two heaps.
+   * @param a Root of the first heap, may be 0.
+   * @param b Root of the second heap, may be 0.
+   * @return Root of the merged heap.
+   */
+  SpinTimer* meld(SpinTimer* a, SpinTimer* b);
+
+  /**
+   * Merge a list of sibling heaps (two pass pairing).
+   * @param first First sibling, may be 0.
+   * @return Root of the merged heap.
+   */
+  SpinTimer* mergePairs(SpinTimer* first);
+
+  /**
+   * Remove the root timer from the heap.
+   * @return Removed timer.
+   */
+  SpinTimer* pop();
+
+  /**
+   * Update the cached time left until the root timer expires, after the heap has changed.
+   */
+  void updateRootLeftTicks();
+
+private:
+  static const unsigned int TAG_QUEUED  = 1;  /// Timer is kept in the heap.
+  static const unsigned int TAG_EXPIRED = 2;  /// Timer is going to be dispatched by the running handleTick().
+
+  SpinTimerTick m_baseTicks;      /// Time of the last dispatch, all the expiration times are related to.
+  SpinTimerTick m_rootLeftTicks;  /// Time left after m_baseTicks until the root timer expires, SPINTIMER_TICK_MAX if the heap is empty.
+  SpinTimer* m_root;               /// Root of the pairing heap, the timer expiring first.
+  SpinTimer* m_expired;            /// Timers to be dispatched by the running handleTick().
+
+private: // forbidden functions
+  SpinTimerHeap(const SpinTimerHeap& src);              // copy constructor
+  SpinTimerHeap& operator = (const SpinTimerHeap& src); // assignment operator
+};
+
+#endif /* SPINTIMERHEAP_H_ */
@@ -0,0 +1,336 @@
+/*
+ * SpinTimerPool.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERPOOL_H_
+#define SPINTIMERPOOL_H_
+
+#ifdef ARDUINO
+#include <new.h>
+#else
+#include <new>
+#endif
+
+#include "SpinTimer.h"
+
+/**
+ * Handle of a timer kept in a SpinTimerPool, @see SpinTimerPool::create().
+ * Refers to a pool slot and to the generation of the slot, so a handle of a released timer gets detected as stale
+ * even if the slot has been reused meanwhile.
+ */
+class SpinTimerHandle
+{
+  template <unsigned int CAPACITY> friend class SpinTimerPool;
+
+public:
+  /**
+   * Constructor, creates a null handle (not referring to any timer).
+   */
+  SpinTimerHandle()
+  : m_index(0)
+  , m_generation(0)
+  { }
+
+  /**
+   * Indicates whether the handle does not refer to any timer (i.e. the pool was exhausted).
+   * A non-null handle may still be stale, @see SpinTimerPool::isValid().
+   * @return true if the handle is a null handle.
+   */
+  bool isNull() const
+  {
+    return 0 == m_generation;
+  }
+
+  bool operator == (const SpinTimerHandle& other) const
+  {
+    return (m_index == other.m_index) && (m_generation == other.m_generation);
+  }
+
+  bool operator != (const SpinTimerHandle& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  SpinTimerHandle(unsigned int index, unsigned int generation)
+  : m_index(index)
+  , m_generation(generation)
+  { }
+
+private:
+  unsigned int m_index;       /// Slot index within the pool.
+  unsigned int m_generation;  /// Generation of the slot at the time the timer has been created, 0: null handle.
+};
+
+/**
+ * Fixed capacity pool of SpinTimer objects, handing out generation checked handles.
+ *
+ * Features:
+ * - the timers are constructed in place within contiguous storage being part of the pool object, no memory gets
+ *   allocated and there is no fragmentation; a statically allocated pool involves no heap at all
+ * - create() and release() are O(1) (free list of slots)
+ * - the timers are controlled by lightweight handles (@see SpinTimerHandle); each slot counts its generation up on
+ *   release, so stale handles are detected safely and the operations on them are ignored
+ * - the timers attach to the context specified with the constructor, the calling thread's default context
+ *   (@see SpinTimerContext::current()) at the time of their creation otherwise; all the other SpinTimer features are
+ *   available through timer()
+ * - a pool and its handles are not thread safe, they must be used by the thread owning the context
+ *
+ * Integration:
+ *
+ *       SpinTimerPool<16> timerPool;
+ *
+ *       void setup()
+ *       {
+ *         SpinTimerHandle blinkTimer = timerPool.create(200, &blinkTimerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+ *         // ..
+ *         timerPool.cancel(blinkTimer);
+ *         timerPool.release(blinkTimer);  // blinkTimer is stale from now on
+ *       }
+ *
+ * @tparam CAPACITY Maximum number of timers kept at the same time.
+ */
+template <unsigned int CAPACITY>
+class SpinTimerPool
+{
+public:
+  /**
+   * Constructor.
+   * @param context SpinTimerContext the timers attach to, default: 0 (SpinTimerContext::current() at the time of create())
+   */
+  SpinTimerPool(SpinTimerContext* context = 0)
+  : m_context(context)
+  , m_firstFree(0)
+  , m_size(0)
+  {
+    for (unsigned int i = 0; i < CAPACITY; i++)
+    {
+      m_slots[i].generation = 1;
+      m_slots[i].nextFree = i + 1;
+      m_slots[i].isInUse = false;
+    }
+  }
+
+  /**
+   * Destructor, destroys the timers still being in use.
+   */
+  ~SpinTimerPool()
+  {
+    for (unsigned int i = 0; i < CAPACITY; i++)
+    {
+      if (m_slots[i].isInUse)
+      {
+        slotTimer(i)->~SpinTimer();
+      }
+    }
+  }
+
+  /**
+   * Create a timer in a free slot, @see SpinTimer().
+   * @param timeMillis Time out or interval time to be set for the timer [ms]; 0 will make the timer expire as soon as possible.
+   * @param action SpinTimerAction, is able to emit a timer expired event to any specific listener, default: 0 (no event will be sent)
+   * @param isRecurring Operation mode, true: recurring, false: non-recurring, default: false
+   * @param isAutostart Autostart mode, true: autostart enabled, false: autostart disabled, default: false
+   * @return Handle of the new timer, null handle if the pool is exhausted.
+   */
+  SpinTimerHandle create(unsigned long timeMillis, SpinTimerAction* action = 0, bool isRecurring = false, bool isAutostart = false)
+  {
+    if (CAPACITY <= m_firstFree)
+    {
+      return SpinTimerHandle();
+    }
+    unsigned int index = m_firstFree;
+    Slot& slot = m_slots[index];
+    m_firstFree = slot.nextFree;
+    new (slot.storage) SpinTimer(timeMillis, action, isRecurring, isAutostart, m_context);
+    slot.isInUse = true;
+    m_size++;
+    return SpinTimerHandle(index, slot.generation);
+  }
+
+  /**
+   * Destroy the timer and free its slot; the handle and all its copies become stale.
+   * @param handle Timer handle.
+   * @return true if the timer has been released, false if the handle is stale.
+   */
+  bool release(const SpinTimerHandle& handle)
+  {
+    if (!isValid(handle))
+    {
+      return false;
+    }
+    Slot& slot = m_slots[handle.m_index];
+    slotTimer(handle.m_index)->~SpinTimer();
+    slot.isInUse = false;
+    slot.generation++;
+    if (0 == slot.generation)
+    {
+      // generation 0 is reserved for the null handle
+      slot.generation = 1;
+    }
+    slot.nextFree = m_firstFree;
+    m_firstFree = handle.m_index;
+    m_size--;
+    return true;
+  }
+
+  /**
+   * Indicates whether the handle refers to a timer of this pool, which has not been released yet.
+   * @param handle Timer handle.
+   * @return true if the handle is valid, false if it is null or stale.
+   */
+  bool isValid(const SpinTimerHandle& handle) const
+  {
+    return (handle.m_index < CAPACITY) &&
+           m_slots[handle.m_index].isInUse &&
+           (m_slots[handle.m_index].generation == handle.m_generation);
+  }
+
+  /**
+   * Timer accessor method.
+   * @param handle Timer handle.
+   * @return SpinTimer object pointer or 0 if the handle is null or stale.
+   */
+  SpinTimer* timer(const SpinTimerHandle& handle)
+  {
+    return isValid(handle) ? slotTimer(handle.m_index) : 0;
+  }
+
+  /**
+   * Start or restart the timer with a specific time out or interval time, @see SpinTimer::start(unsigned long timeMillis).
+   * @param handle Timer handle.
+   * @param timeMillis Time out or interval time to be set for the timer [ms].
+   * @return true if the timer has been started, false if the handle is stale.
+   */
+  bool start(const SpinTimerHandle& handle, unsigned long timeMillis)
+  {
+    SpinTimer* spinTimer = timer(handle);
+    if (0 == spinTimer)
+    {
+      return false;
+    }
+    spinTimer->start(timeMillis);
+    return true;
+  }
+
+  /**
+   * Start or restart the timer, @see SpinTimer::start().
+   * @param handle Timer handle.
+   * @return true if the timer has been started, false if the handle is stale.
+   */
+  bool start(const SpinTimerHandle& handle)
+  {
+    SpinTimer* spinTimer = timer(handle);
+    if (0 == spinTimer)
+    {
+      return false;
+    }
+    spinTimer->start();
+    return true;
+  }
+
+  /**
+   * Restart the timer cheaply, @see SpinTimer::restart().
+   * @param handle Timer handle.
+   * @return true if the timer has been restarted, false if the handle is stale.
+   */
+  bool restart(const SpinTimerHandle& handle)
+  {
+    SpinTimer* spinTimer = timer(handle);
+    if (0 == spinTimer)
+    {
+      return false;
+    }
+    spinTimer->restart();
+    return true;
+  }
+
+  /**
+   * Cancel the timer and stop, @see SpinTimer::cancel().
+   * @param handle Timer handle.
+   * @return true if the timer has been cancelled, false if the handle is stale.
+   */
+  bool cancel(const SpinTimerHandle& handle)
+  {
+    SpinTimer* spinTimer = timer(handle);
+    if (0 == spinTimer)
+    {
+      return false;
+    }
+    spinTimer->cancel();
+    return true;
+  }
+
+  /**
+   * Poll the timer expire status, @see SpinTimer::isExpired().
+   * @param handle Timer handle.
+   * @return true if the timer has expired, false if not or if the handle is stale.
+   */
+  bool isExpired(const SpinTimerHandle& handle)
+  {
+    SpinTimer* spinTimer = timer(handle);
+    return (0 != spinTimer) && spinTimer->isExpired();
+  }
+
+  /**
+   * Indicates whether the timer is currently running, @see SpinTimer::isRunning().
+   * @param handle Timer handle.
+   * @return true if the timer is running, false if not or if the handle is stale.
+   */
+  bool isRunning(const SpinTimerHandle& handle) const
+  {
+    return isValid(handle) && slotTimer(handle.m_index)->isRunning();
+  }
+
+  /**
+   * Number of timers in use.
+   * @return Number of timers created and not released yet.
+   */
+  unsigned int size() const
+  {
+    return m_size;
+  }
+
+  /**
+   * Maximum number of timers kept at the same time.
+   * @return CAPACITY
+   */
+  unsigned int capacity() const
+  {
+    return CAPACITY;
+  }
+
+private:
+  SpinTimer* slotTimer(unsigned int index)
+  {
+    return reinterpret_cast<SpinTimer*>(m_slots[index].storage);
+  }
+
+  const SpinTimer* slotTimer(unsigned int index) const
+  {
+    return reinterpret_cast<const SpinTimer*>(m_slots[index].storage);
+  }
+
+private:
+  struct Slot
+  {
+    alignas(SpinTimer) unsigned char storage[sizeof(SpinTimer)];  /// Storage of the timer object.
+    unsigned int generation;  /// Counted up on release, never 0.
+    unsigned int nextFree;    /// Index of the next free slot, CAPACITY: none.
+    bool isInUse;             /// Storage holds a timer object.
+  };
+
+  SpinTimerContext* m_context;  /// Context the timers attach to, 0: SpinTimerContext::current().
+  Slot m_slots[CAPACITY];       /// Contiguous timer storage.
+  unsigned int m_firstFree;     /// Head of the free slot list, CAPACITY: pool exhausted.
+  unsigned int m_size;          /// Number of timers in use.
+
+private: // forbidden functions
+  SpinTimerPool(const SpinTimerPool& src);              // copy constructor
+  SpinTimerPool& operator = (const SpinTimerPool& src); // assignment operator
+};
+
+#endif /* SPINTIMERPOOL_H_ */
@@ -0,0 +1,206 @@
+/*
+ * SpinTimerScan.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerScan.h"
+#include "SpinTimerContext.h"
+
+#if (ULONG_MAX > 0xFFFFFFFFUL) || !SPINTIMER_TICK_WRAPAROUND
+#if defined(__AVX2__)
+#define SPINTIMER_SCAN_AVX2   /// 4 deadlines per compare.
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#define SPINTIMER_SCAN_SSE2   /// 2 deadlines per compare.
+#include <emmintrin.h>
+#endif
+#endif
+
+const unsigned int SpinTimerScan::TAG_EXPIRED;
+
+SpinTimerScan::SpinTimerScan(unsigned long capacity)
+: m_deadlines(0)
+, m_timers(0)
+, m_count(0)
+, m_capacity(0)
+, m_expired(0)
+{
+  if (0 != capacity)
+  {
+    m_deadlines = new SpinTimerTick[capacity];
+    m_timers = new SpinTimer*[capacity];
+    m_capacity = capacity;
+  }
+}
+
+SpinTimerScan::~SpinTimerScan()
+{
+  delete [] m_deadlines;
+  delete [] m_timers;
+}
+
+void SpinTimerScan::reset(SpinTimerTick nowTicks)
+{
+  (void)nowTicks;
+  m_count = 0;
+  m_expired = 0;
+}
+
+void SpinTimerScan::schedule(SpinTimer* timer)
+{
+  SpinTimerTick startTicks = currentTicks(timer);
+  SpinTimerTick deadlineTicks = startTicks + remainingTicks(timer, startTicks);
+
+  unsigned int tag = engineTag(timer);
+  if ((0 != tag) && (TAG_EXPIRED != tag))
+  {
+    // already kept in the arrays, update in place
+    m_deadlines[tag - 1] = deadlineTicks;
+    return;
+  }
+
+  unschedule(timer);
+  if (m_count == m_capacity)
+  {
+    grow();
+  }
+  m_deadlines[m_count] = deadlineTicks;
+  m_timers[m_count] = timer;
+  m_count++;
+  engineTag(timer) = static_cast<unsigned int>(m_count);
+}
+
+void SpinTimerScan::unschedule(SpinTimer* timer)
+{
+  unsigned int tag = engineTag(timer);
+  if (TAG_EXPIRED == tag)
+  {
+    listRemove(m_expired, timer);
+  }
+  else if (0 != tag)
+  {
+    removeAt(tag - 1);
+    engineTag(timer) = 0;
+  }
+}
+
+void SpinTimerScan::handleTick(SpinTimerTick nowTicks)
+{
+  SpinTimer* due = scan(nowTicks);
+
+  // take the due timers out of the arrays before dispatching any of them
+  while (0 != due)
+  {
+    SpinTimer* timer = due;
+    due = engineNext(timer);
+    engineNext(timer) = 0;
+    removeAt(engineTag(timer) - 1);
+    listAppend(m_expired, timer, TAG_EXPIRED);
+  }
+
+  // dispatch, a recurring timer will be re-scheduled
+  while (0 != m_expired)
+  {
+    SpinTimer* timer = m_expired;
+    listRemove(m_expired, timer);
+    expire(timer, nowTicks);
+  }
+}
+
+SpinTimerTick SpinTimerScan::nextExpiryTicks(SpinTimerTick nowTicks)
+{
+  if (0 != m_expired)
+  {
+    return 0;
+  }
+
+  SpinTimerTick nextTicks = SpinTimerContext::NO_EXPIRY_TICKS;
+  for (unsigned long i = 0; i < m_count; i++)
+  {
+    SpinTimerTickDiff leftTicks = static_cast<SpinTimerTickDiff>(m_deadlines[i] - nowTicks);
+    if (leftTicks <= 0)
+    {
+      return 0;
+    }
+    if (static_cast<SpinTimerTick>(leftTicks) < nextTicks)
+    {
+      nextTicks = static_cast<SpinTimerTick>(leftTicks);
+    }
+  }
+  return nextTicks;
+}
+
+void SpinTimerScan::removeAt(unsigned long index)
+{
+  m_count--;
+  if (index != m_count)
+  {
+    m_deadlines[index] = m_deadlines[m_count];
+    m_timers[index] = m_timers[m_count];
+    engineTag(m_timers[index]) = static_cast<unsigned int>(index + 1);
+  }
+}
+
+void SpinTimerScan::grow()
+{
+  unsigned long capacity = (0 == m_capacity) ? 64 : 2 * m_capacity;
+  SpinTimerTick* deadlines = new SpinTimerTick[capacity];
+  SpinTimer** timers = new SpinTimer*[capacity];
+  for (unsigned long i = 0; i < m_count; i++)
+  {
+    deadlines[i] = m_deadlines[i];
+    timers[i] = m_timers[i];
+  }
+  delete [] m_deadlines;
+  delete [] m_timers;
+  m_deadlines = deadlines;
+  m_timers = timers;
+  m_capacity = capacity;
+}
+
+SpinTimer* SpinTimerScan::scan(SpinTimerTick nowTicks)
+{
+  SpinTimer* first = 0;
+  SpinTimer* last = 0;
+  unsigned long i = 0;
+
+  // a timer is due when the signed difference nowTicks - deadline is not negative (wrap-safe),
+  // the vector variants test the sign bits of 4 (AVX2) or 2 (SSE2) differences at once
+#if defined(SPINTIMER_SCAN_AVX2)
+  const __m256i now = _mm256_set1_epi64x(static_cast<long long>(nowTicks));
+  for (; i + 4 <= m_count; i += 4)
+  {
+    __m256i diff = _mm256_sub_epi64(now, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&m_deadlines[i])));
+    unsigned int hits = ~static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(diff))) & 0xFU;
+    while (0 != hits)
+    {
+      append(first, last, m_timers[i + __builtin_ctz(hits)]);
+      hits &= hits - 1;
+    }
+  }
+#elif defined(SPINTIMER_SCAN_SSE2)
+  const __m128i now = _mm_set1_epi64x(static_cast<long long>(nowTicks));
+  for (; i + 2 <= m_count; i += 2)
+  {
+    __m128i diff = _mm_sub_epi64(now, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&m_deadlines[i])));
+    unsigned int hits = ~static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(diff))) & 0x3U;
+    while (0 != hits)
+    {
+      append(first, last, m_timers[i + __builtin_ctz(hits)]);
+      hits &= hits - 1;
+    }
+  }
+#endif
+
+  // scalar compare of the remaining deadlines
+  for (; i < m_count; i++)
+  {
+    if (static_cast<SpinTimerTickDiff>(nowTicks - m_deadlines[i]) >= 0)
+    {
+      append(first, last, m_timers[i]);
+    }
+  }
+  return first;
+}
@@ -0,0 +1,103 @@
+/*
+ * SpinTimerSimulator.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerSimulator.h"
+#include "SpinTimerContext.h"
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+#include <time.h>
+#define SPINTIMER_SIMULATOR_PACING
+#endif
+
+SpinTimerSimulator::SpinTimerSimulator(SpinTimerContext* context, SpinTimerTick timeTicks)
+: m_context((0 != context) ? context : SpinTimerContext::current())
+, m_clock(timeTicks)
+, m_previousAdapter(UptimeInfo::Instance()->adapter())
+, m_speedFactor(0)
+{
+  UptimeInfo::Instance()->setAdapter(&m_clock);
+}
+
+SpinTimerSimulator::~SpinTimerSimulator()
+{
+  UptimeInfo::Instance()->setAdapter(m_previousAdapter);
+}
+
+unsigned long SpinTimerSimulator::run(unsigned long durationMillis)
+{
+  return runTicks(static_cast<SpinTimerTick>(durationMillis) * SPINTIMER_TICKS_PER_MILLI);
+}
+
+unsigned long SpinTimerSimulator::runTicks(SpinTimerTick durationTicks)
+{
+  unsigned long kicks = 0;
+  SpinTimerTick leftTicks = durationTicks;
+  bool isFirstKick = true;
+  for (;;)
+  {
+    SpinTimerTick nextTicks = m_context->nextExpiryTicks();
+    if ((0 == nextTicks) && !isFirstKick)
+    {
+      // due again right away, fires with the next tick
+      nextTicks = 1;
+    }
+    if ((SpinTimerContext::NO_EXPIRY_TICKS == nextTicks) || (nextTicks > leftTicks))
+    {
+      break;
+    }
+    advance(nextTicks);
+    kicks++;
+    leftTicks -= nextTicks;
+    isFirstKick = false;
+  }
+
+  // the rest of the time passes without any timer being due
+  m_clock.advanceTicks(leftTicks);
+  return kicks;
+}
+
+bool SpinTimerSimulator::step()
+{
+  SpinTimerTick nextTicks = m_context->nextExpiryTicks();
+  if (SpinTimerContext::NO_EXPIRY_TICKS == nextTicks)
+  {
+    return false;
+  }
+  advance(nextTicks);
+  return true;
+}
+
+void SpinTimerSimulator::setSpeedFactor(double speedFactor)
+{
+  m_speedFactor = speedFactor;
+}
+
+VirtualUptimeInfoAdapter& SpinTimerSimulator::clock()
+{
+  return m_clock;
+}
+
+SpinTimerTick SpinTimerSimulator::nowTicks()
+{
+  return m_clock.tTicks();
+}
+
+void SpinTimerSimulator::advance(SpinTimerTick deltaTicks)
+{
+#ifdef SPINTIMER_SIMULATOR_PACING
+  if ((m_speedFactor > 0) && (0 != deltaTicks))
+  {
+    double sleepNanos = static_cast<double>(deltaTicks) * (1000000.0 / SPINTIMER_TICKS_PER_MILLI) / m_speedFactor;
+    struct timespec request;
+    request.tv_sec  = static_cast<time_t>(sleepNanos / 1e9);
+    request.tv_nsec = static_cast<long>(sleepNanos - static_cast<double>(request.tv_sec) * 1e9);
+    nanosleep(&request, 0);
+  }
+#endif
+  m_clock.advanceTicks(deltaTicks);
+  m_context->handleTick();
+}
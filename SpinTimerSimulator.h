@@ -0,0 +1,106 @@
+/*
+ * SpinTimerSimulator.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERSIMULATOR_H_
+#define SPINTIMERSIMULATOR_H_
+
+#include "SpinTimerTick.h"
+#include "VirtualUptimeInfoAdapter.h"
+
+class SpinTimerContext;
+
+/**
+ * Virtual time driver of a SpinTimerContext, for simulations and tests.
+ *
+ * Features:
+ * - installs its own simulated clock (@see VirtualUptimeInfoAdapter) as the UptimeInfo adapter while it exists,
+ *   the previous adapter gets restored on destruction
+ * - run() jumps the clock straight to the next deadline (@see SpinTimerContext::nextExpiryTicks()), kicks the context
+ *   so everything being due fires, and repeats until the requested time has passed; hours of timer behaviour run in
+ *   milliseconds, with a deterministic order
+ * - timers being due again right away (i.e. recurring timers with an interval of 0) fire once per tick, as they do
+ *   with a real clock
+ * - optional speed factor, paces the simulation relative to the wall clock (not available on Arduino)
+ *
+ * Integration:
+ *
+ *       SpinTimerSimulator simulator;
+ *       SpinTimer timer(1000, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+ *       simulator.run(10UL * 3600 * 1000);  // 10 hours, action notified 36'000 times
+ */
+class SpinTimerSimulator
+{
+public:
+  /**
+   * Constructor, installs the simulated clock.
+   * @param context SpinTimerContext to be driven, default: 0 (SpinTimerContext::current())
+   * @param timeTicks Initial up-time [ticks], default: 0
+   */
+  SpinTimerSimulator(SpinTimerContext* context = 0, SpinTimerTick timeTicks = 0);
+
+  /**
+   * Destructor, restores the previous UptimeInfo adapter.
+   */
+  virtual ~SpinTimerSimulator();
+
+  /**
+   * Advance the simulated time by jumping from deadline to deadline, firing all the timers being due.
+   * @param durationMillis Time to simulate [ms].
+   * @return Number of context kicks (SpinTimerContext::handleTick() calls).
+   */
+  unsigned long run(unsigned long durationMillis);
+
+  /**
+   * Advance the simulated time by jumping from deadline to deadline, firing all the timers being due.
+   * @param durationTicks Time to simulate [ticks].
+   * @return Number of context kicks (SpinTimerContext::handleTick() calls).
+   */
+  unsigned long runTicks(SpinTimerTick durationTicks);
+
+  /**
+   * Jump to the next deadline and fire all the timers being due then.
+   * @return true if a timer has been due, false if no timer is running (the time does not change).
+   */
+  bool step();
+
+  /**
+   * Set the pace of the simulation.
+   * @param speedFactor Simulated time per wall clock time, i.e. 60: one simulated hour per minute; 0: as fast as possible (default).
+   */
+  void setSpeedFactor(double speedFactor);
+
+  /**
+   * Simulated clock accessor method.
+   * @return Simulated clock, may be advanced by the application as well.
+   */
+  VirtualUptimeInfoAdapter& clock();
+
+  /**
+   * Current simulated up-time.
+   * @return Up-time [ticks].
+   */
+  SpinTimerTick nowTicks();
+
+private:
+  /**
+   * Advance the clock and kick the context.
+   * @param deltaTicks Time to advance [ticks].
+   */
+  void advance(SpinTimerTick deltaTicks);
+
+private:
+  SpinTimerContext* m_context;           /// Context being driven.
+  VirtualUptimeInfoAdapter m_clock;      /// Simulated clock.
+  UptimeInfoAdapter* m_previousAdapter;  /// Adapter to be restored on destruction.
+  double m_speedFactor;                  /// Simulated time per wall clock time, 0: as fast as possible.
+
+private: // forbidden functions
+  SpinTimerSimulator(const SpinTimerSimulator& src);              // copy constructor
+  SpinTimerSimulator& operator = (const SpinTimerSimulator& src); // assignment operator
+};
+
+#endif /* SPINTIMERSIMULATOR_H_ */
@@ -0,0 +1,161 @@
+/*
+ * SpinTimerSleepQueue.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerSleepQueue.h"
+#include "UptimeInfo.h"
+
+SpinTimerSleepQueue::SpinTimerSleepQueue(SpinTimerContext* context)
+: SpinTimer(0, 0, IS_NON_RECURRING, IS_NON_AUTOSTART, context)
+, m_first(0)
+, m_last(0)
+, m_size(0)
+{
+  attachCallback(&SpinTimerSleepQueue::timeExpired);
+  bypassDispatcher();
+}
+
+SpinTimerSleepQueue::~SpinTimerSleepQueue()
+{
+  // the sleepers are not accessed, they may have gone already (i.e. the frames of coroutines suspended at the process exit)
+  m_first = 0;
+  m_last = 0;
+  m_size = 0;
+}
+
+void SpinTimerSleepQueue::sleep(SpinTimerSleeper* sleeper, SpinTimerTick delayTicks)
+{
+  if (0 != sleeper->queue)
+  {
+    sleeper->queue->cancel(sleeper);
+  }
+  sleeper->deadlineTicks = UptimeInfo::Instance()->tTicks() + delayTicks;
+
+  // search from the tail, the sleepers with the same delay come in deadline order
+  SpinTimerSleeper* prev = m_last;
+  while ((0 != prev) && (static_cast<SpinTimerTickDiff>(sleeper->deadlineTicks - prev->deadlineTicks) < 0))
+  {
+    prev = prev->prev;
+  }
+  sleeper->prev = prev;
+  sleeper->next = (0 != prev) ? prev->next : m_first;
+  if (0 != sleeper->next)
+  {
+    sleeper->next->prev = sleeper;
+  }
+  else
+  {
+    m_last = sleeper;
+  }
+  if (0 != prev)
+  {
+    prev->next = sleeper;
+  }
+  else
+  {
+    m_first = sleeper;
+  }
+  sleeper->queue = this;
+  m_size++;
+
+  if (m_first == sleeper)
+  {
+    rearm();
+  }
+}
+
+void SpinTimerSleepQueue::cancel(SpinTimerSleeper* sleeper)
+{
+  if (this != sleeper->queue)
+  {
+    return;
+  }
+  bool wasFirst = (m_first == sleeper);
+  unlink(sleeper);
+  if (wasFirst)
+  {
+    rearm();
+  }
+}
+
+unsigned long SpinTimerSleepQueue::size() const
+{
+  return m_size;
+}
+
+void SpinTimerSleepQueue::timeExpired(SpinTimer* timer)
+{
+  static_cast<SpinTimerSleepQueue*>(timer)->wakeUp();
+}
+
+void SpinTimerSleepQueue::wakeUp()
+{
+  SpinTimerTick nowTicks = UptimeInfo::Instance()->tTicks();
+
+  // take the due sleepers out of the list before waking up any of them, the ones going to sleep again
+  // (even with a delay of 0) are woken up by a later call
+  SpinTimerSleeper* due = 0;
+  SpinTimerSleeper* dueLast = 0;
+  while ((0 != m_first) && (static_cast<SpinTimerTickDiff>(nowTicks - m_first->deadlineTicks) >= 0))
+  {
+    SpinTimerSleeper* sleeper = m_first;
+    unlink(sleeper);
+    if (0 == dueLast)
+    {
+      due = sleeper;
+    }
+    else
+    {
+      dueLast->next = sleeper;
+    }
+    dueLast = sleeper;
+  }
+  rearm();
+
+  while (0 != due)
+  {
+    SpinTimerSleeper* sleeper = due;
+    due = sleeper->next;
+    sleeper->next = 0;
+    // the sleeper may not be accessed anymore after resume() (i.e. the coroutine frame has been destroyed)
+    sleeper->resume(sleeper->arg);
+  }
+}
+
+void SpinTimerSleepQueue::rearm()
+{
+  if (0 == m_first)
+  {
+    SpinTimer::cancel();
+    return;
+  }
+  SpinTimerTickDiff leftTicks = static_cast<SpinTimerTickDiff>(m_first->deadlineTicks - UptimeInfo::Instance()->tTicks());
+  startTicks((leftTicks > 0) ? static_cast<SpinTimerTick>(leftTicks) : 0);
+}
+
+void SpinTimerSleepQueue::unlink(SpinTimerSleeper* sleeper)
+{
+  if (0 != sleeper->prev)
+  {
+    sleeper->prev->next = sleeper->next;
+  }
+  else
+  {
+    m_first = sleeper->next;
+  }
+  if (0 != sleeper->next)
+  {
+    sleeper->next->prev = sleeper->prev;
+  }
+  else
+  {
+    m_last = sleeper->prev;
+  }
+  sleeper->next = 0;
+  sleeper->prev = 0;
+  sleeper->queue = 0;
+  m_size--;
+}
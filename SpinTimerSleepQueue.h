@@ -0,0 +1,126 @@
+/*
+ * SpinTimerSleepQueue.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERSLEEPQUEUE_H_
+#define SPINTIMERSLEEPQUEUE_H_
+
+#include "SpinTimer.h"
+
+class SpinTimerSleepQueue;
+
+/**
+ * Sleeper kept in a SpinTimerSleepQueue, provided by the caller (i.e. as part of a coroutine frame).
+ */
+struct SpinTimerSleeper
+{
+  typedef void (*Resume)(void* arg);
+
+  SpinTimerTick deadlineTicks;   /// Wake up time [ticks].
+  Resume resume;                 /// Called out when the deadline has come.
+  void* arg;                     /// Argument of the resume function.
+  SpinTimerSleeper* next;        /// Next sleeper, later deadline.
+  SpinTimerSleeper* prev;        /// Previous sleeper, earlier deadline.
+  SpinTimerSleepQueue* queue;    /// Queue the sleeper is kept in, 0: not sleeping.
+
+  SpinTimerSleeper(Resume resume = 0, void* arg = 0)
+  : deadlineTicks(0)
+  , resume(resume)
+  , arg(arg)
+  , next(0)
+  , prev(0)
+  , queue(0)
+  { }
+};
+
+/**
+ * Deadline ordered queue of lightweight sleepers, driven by one single timer.
+ *
+ * Features:
+ * - a sleeper (@see SpinTimerSleeper) is a plain node of a few words, to be provided by the caller; there is no
+ *   SpinTimer object and no SpinTimerAction object per sleeper
+ * - the sleepers are kept in a double linked list ordered by their deadlines, sleepers with the same deadline are
+ *   woken up in the order they went to sleep; a sleeper is inserted searching from the list's tail, so sleepers with
+ *   the same delay are inserted in constant time
+ * - the queue's own non-recurring timer is kept running towards the earliest deadline, so the sleepers are woken up
+ *   directly from SpinTimerContext::handleTick(), without any polling; always by the thread kicking the context, also
+ *   if the context has a dispatcher (@see SpinTimerContext::setDispatcher())
+ * - each SpinTimerContext provides its queue on demand (@see SpinTimerContext::sleepQueue()), used by the coroutine
+ *   awaitables (@see SpinTimerCoroutine.h)
+ *
+ * Integration:
+ *
+ *       SpinTimerSleeper sleeper(&wakeUp, &myObject);
+ *       SpinTimerContext::current()->sleepQueue()->sleep(&sleeper, 100 * SPINTIMER_TICKS_PER_MILLI);
+ */
+class SpinTimerSleepQueue : private SpinTimer
+{
+public:
+  /**
+   * Constructor.
+   * @param context SpinTimerContext the queue's timer attaches to, default: 0 (SpinTimerContext::current())
+   */
+  SpinTimerSleepQueue(SpinTimerContext* context = 0);
+
+  /**
+   * Destructor, the sleepers still being kept are dropped without being woken up and without being accessed;
+   * they must not be used anymore afterwards.
+   */
+  virtual ~SpinTimerSleepQueue();
+
+  /**
+   * Put a sleeper to sleep, a sleeper already sleeping gets rescheduled.
+   * @param sleeper Sleeper, must stay valid until it has been woken up or cancelled.
+   * @param delayTicks Time to sleep [ticks]; 0 wakes the sleeper up with the next SpinTimerContext::handleTick() call.
+   */
+  void sleep(SpinTimerSleeper* sleeper, SpinTimerTick delayTicks);
+
+  /**
+   * Remove a sleeper without waking it up, does nothing if the sleeper is not kept in this queue.
+   * @param sleeper Sleeper.
+   */
+  void cancel(SpinTimerSleeper* sleeper);
+
+  /**
+   * Number of sleepers.
+   * @return Number of sleepers kept in the queue.
+   */
+  unsigned long size() const;
+
+private:
+  /**
+   * Trampoline, called out by the queue's timer.
+   * @param timer The queue's timer.
+   */
+  static void timeExpired(SpinTimer* timer);
+
+  /**
+   * Wake up all the sleepers being due.
+   */
+  void wakeUp();
+
+  /**
+   * Restart the queue's timer towards the earliest deadline, cancel it if the queue is empty.
+   */
+  void rearm();
+
+  /**
+   * Unlink a sleeper from the list.
+   * @param sleeper Sleeper.
+   */
+  void unlink(SpinTimerSleeper* sleeper);
+
+private:
+  SpinTimerSleeper* m_first;   /// Sleeper with the earliest deadline.
+  SpinTimerSleeper* m_last;    /// Sleeper with the latest deadline.
+  unsigned long m_size;        /// Number of sleepers.
+
+private: // forbidden functions
+  SpinTimerSleepQueue(const SpinTimerSleepQueue& src);              // copy constructor
+  SpinTimerSleepQueue& operator = (const SpinTimerSleepQueue& src); // assignment operator
+};
+
+#endif /* SPINTIMERSLEEPQUEUE_H_ */
@@ -0,0 +1,150 @@
+/*
+ * SpinTimerStatistics.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERSTATISTICS_H_
+#define SPINTIMERSTATISTICS_H_
+
+#include "SpinTimerTick.h"
+
+/**
+ * Runtime statistics configuration, selected at compile time.
+ *
+ * - default: no statistics are recorded, the instrumentation compiles to nothing
+ * - SPINTIMER_STATISTICS defined: each SpinTimer records its SpinTimerStatistics (@see SpinTimer::statistics()),
+ *   each SpinTimerContext records its SpinTimerContextStatistics (@see SpinTimerContext::statistics());
+ *   the CMake build provides the SpinTimerStatistics library variant
+ *
+ * Durations are measured with the up-time info (@see UptimeInfo::tTicks()), so their resolution is the one of the
+ * configured time base (@see SpinTimerTick.h).
+ */
+#ifdef SPINTIMER_STATISTICS
+
+/**
+ * Runtime statistics of a SpinTimer.
+ */
+struct SpinTimerStatistics
+{
+  /**
+   * Number of buckets of the lateness histogram.
+   * Bucket 0 counts the expirations notified right at their deadline, bucket n (n > 0) counts the expirations
+   * notified 2^(n-1) .. 2^n - 1 ticks late; the last bucket counts all the expirations being even later.
+   */
+  static const unsigned int LATENESS_BUCKETS = 16;
+
+  unsigned long fireCount;                             /// Number of expirations.
+  SpinTimerTick maxLatenessTicks;                      /// Maximum time the expiration has been notified after the deadline [ticks].
+  unsigned long latenessHistogram[LATENESS_BUCKETS];   /// Number of expirations per lateness range, @see LATENESS_BUCKETS.
+  SpinTimerTick maxCallbackTicks;                      /// Maximum duration of the time expired notification (action or callback) [ticks].
+
+  SpinTimerStatistics()
+  {
+    reset();
+  }
+
+  /**
+   * Clear all the figures.
+   */
+  void reset()
+  {
+    fireCount = 0;
+    maxLatenessTicks = 0;
+    for (unsigned int i = 0; i < LATENESS_BUCKETS; i++)
+    {
+      latenessHistogram[i] = 0;
+    }
+    maxCallbackTicks = 0;
+  }
+
+  /**
+   * Record an expiration.
+   * @param latenessTicks Time the expiration has been notified after the deadline [ticks], i.e. when the action
+   *                      gets called by the dispatcher or by a budgeted handleTick() call.
+   */
+  void recordExpiration(SpinTimerTick latenessTicks)
+  {
+    fireCount++;
+    if (latenessTicks > maxLatenessTicks)
+    {
+      maxLatenessTicks = latenessTicks;
+    }
+    unsigned int bucket = 0;
+    while ((0 != latenessTicks) && (bucket < LATENESS_BUCKETS - 1))
+    {
+      latenessTicks >>= 1;
+      bucket++;
+    }
+    latenessHistogram[bucket]++;
+  }
+
+  /**
+   * Record the duration of a time expired notification.
+   * @param callbackTicks Duration [ticks].
+   */
+  void recordCallback(SpinTimerTick callbackTicks)
+  {
+    if (callbackTicks > maxCallbackTicks)
+    {
+      maxCallbackTicks = callbackTicks;
+    }
+  }
+};
+
+/**
+ * Runtime statistics of a SpinTimerContext.
+ */
+struct SpinTimerContextStatistics
+{
+  unsigned long tickCount;             /// Number of handleTick() calls.
+  SpinTimerTick lastTickTicks;         /// Duration of the latest handleTick() call [ticks].
+  SpinTimerTick maxTickTicks;          /// Maximum duration of a handleTick() call [ticks].
+  SpinTimerTick totalTickTicks;        /// Accumulated duration of all handleTick() calls [ticks].
+  unsigned long lastVisitedCount;      /// Number of timers visited by the latest handleTick() call.
+  unsigned long maxVisitedCount;       /// Maximum number of timers visited by a handleTick() call.
+
+  SpinTimerContextStatistics()
+  {
+    reset();
+  }
+
+  /**
+   * Clear all the figures.
+   */
+  void reset()
+  {
+    tickCount = 0;
+    lastTickTicks = 0;
+    maxTickTicks = 0;
+    totalTickTicks = 0;
+    lastVisitedCount = 0;
+    maxVisitedCount = 0;
+  }
+
+  /**
+   * Record a handleTick() call.
+   * @param tickTicks Duration [ticks].
+   * @param visitedCount Number of timers visited: all attached timers without engine, the expired ones with an engine.
+   */
+  void recordTick(SpinTimerTick tickTicks, unsigned long visitedCount)
+  {
+    tickCount++;
+    lastTickTicks = tickTicks;
+    if (tickTicks > maxTickTicks)
+    {
+      maxTickTicks = tickTicks;
+    }
+    totalTickTicks += tickTicks;
+    lastVisitedCount = visitedCount;
+    if (visitedCount > maxVisitedCount)
+    {
+      maxVisitedCount = visitedCount;
+    }
+  }
+};
+
+#endif
+
+#endif /* SPINTIMERSTATISTICS_H_ */
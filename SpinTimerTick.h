@@ -0,0 +1,43 @@
+/*
+ * SpinTimerTick.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERTICK_H_
+#define SPINTIMERTICK_H_
+
+#include <limits.h>
+
+/**
+ * Time base configuration, selected at compile time.
+ *
+ * - default: unsigned long milliseconds, as provided by UptimeInfoAdapter::tMillis()
+ *   (i.e. Arduino: millis() function or STM32: HAL_GetTick() function);
+ *   unsigned long int overflows (occurring around every 50 hours with 32 bit) are handled
+ * - SPINTIMER_TICK_MICROS defined: 64 bit microseconds, as provided by UptimeInfoAdapter::tTicks()
+ * - SPINTIMER_TICK_NANOS defined: 64 bit nanoseconds, as provided by UptimeInfoAdapter::tTicks()
+ *
+ * The 64 bit time bases are expected to be monotonic and to start near zero (i.e. MonotonicUptimeInfoAdapter or
+ * TscUptimeInfoAdapter), they will not overflow within centuries, so the overflow handling gets compiled out.
+ */
+#if defined(SPINTIMER_TICK_NANOS) || defined(SPINTIMER_TICK_MICROS)
+typedef unsigned long long SpinTimerTick;     /// Time representation [ticks].
+typedef long long SpinTimerTickDiff;          /// Signed difference of two SpinTimerTick values [ticks].
+#if defined(SPINTIMER_TICK_NANOS)
+#define SPINTIMER_TICKS_PER_MILLI 1000000ULL
+#else
+#define SPINTIMER_TICKS_PER_MILLI 1000ULL
+#endif
+#define SPINTIMER_TICK_WRAPAROUND 0
+#define SPINTIMER_TICK_MAX ULLONG_MAX
+#else
+typedef unsigned long SpinTimerTick;          /// Time representation [ticks].
+typedef long SpinTimerTickDiff;               /// Signed difference of two SpinTimerTick values [ticks].
+#define SPINTIMER_TICKS_PER_MILLI 1UL
+#define SPINTIMER_TICK_WRAPAROUND 1
+#define SPINTIMER_TICK_MAX ULONG_MAX
+#endif
+
+#endif /* SPINTIMERTICK_H_ */
@@ -0,0 +1,179 @@
+/*
+ * SpinTimerTrace.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerTrace.h"
+
+#if defined(SPINTIMER_TRACE) && !defined(ARDUINO)
+
+#include <string.h>
+#include <new>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SPINTIMER_TRACE_FILE_MAPPING
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+const uint32_t SpinTimerTrace::VERSION;
+
+std::atomic<SpinTimerTrace*> SpinTimerTrace::s_installed(0);
+std::atomic<unsigned long> SpinTimerTrace::s_emitters(0);
+
+SpinTimerTrace::SpinTimerTrace(unsigned long capacity)
+: m_header(0)
+, m_records(0)
+, m_mask(0)
+, m_memory(0)
+, m_mappedSize(0)
+{
+  uint64_t records = roundUp(capacity);
+  m_memory = new unsigned char[size(records)];
+  memset(m_memory, 0, size(records));
+  init(m_memory, records);
+}
+
+SpinTimerTrace::SpinTimerTrace(const char* path, unsigned long capacity)
+: m_header(0)
+, m_records(0)
+, m_mask(0)
+, m_memory(0)
+, m_mappedSize(0)
+{
+#ifdef SPINTIMER_TRACE_FILE_MAPPING
+  uint64_t records = roundUp(capacity);
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0)
+  {
+    return;
+  }
+  // the truncated file reads as zeros
+  if (0 == ftruncate(fd, static_cast<off_t>(size(records))))
+  {
+    void* memory = mmap(0, size(records), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED != memory)
+    {
+      m_mappedSize = size(records);
+      init(memory, records);
+    }
+  }
+  close(fd);
+#else
+  (void)path;
+  (void)capacity;
+#endif
+}
+
+SpinTimerTrace::~SpinTimerTrace()
+{
+  SpinTimerTrace* self = this;
+  s_installed.compare_exchange_strong(self, 0, std::memory_order_seq_cst);
+
+  // also when replaced already, an emitter might still write to this buffer
+  waitForEmitters();
+
+  if (0 != m_memory)
+  {
+    delete [] m_memory;
+  }
+#ifdef SPINTIMER_TRACE_FILE_MAPPING
+  else if (0 != m_header)
+  {
+    munmap(m_header, m_mappedSize);
+  }
+#endif
+}
+
+bool SpinTimerTrace::isOpen() const
+{
+  return 0 != m_header;
+}
+
+void SpinTimerTrace::install()
+{
+  if (isOpen())
+  {
+    s_installed.store(this, std::memory_order_release);
+  }
+}
+
+void SpinTimerTrace::uninstall()
+{
+  s_installed.store(0, std::memory_order_seq_cst);
+  waitForEmitters();
+}
+
+SpinTimerTrace* SpinTimerTrace::installed()
+{
+  return s_installed.load(std::memory_order_acquire);
+}
+
+uint64_t SpinTimerTrace::count() const
+{
+  return (0 != m_header) ? m_header->writeIndex.load(std::memory_order_acquire) : 0;
+}
+
+uint64_t SpinTimerTrace::capacity() const
+{
+  return m_mask + 1;
+}
+
+bool SpinTimerTrace::read(uint64_t index, SpinTimerTraceRecord& record) const
+{
+  if (0 == m_header)
+  {
+    return false;
+  }
+  const SpinTimerTraceRecord& source = m_records[index & m_mask];
+  uint32_t sequence = __atomic_load_n(&source.sequence, __ATOMIC_ACQUIRE);
+  record.timeTicks = source.timeTicks;
+  record.object = source.object;
+  record.value = source.value;
+  record.event = source.event;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  record.sequence = __atomic_load_n(&source.sequence, __ATOMIC_RELAXED);
+  return (static_cast<uint32_t>(index + 1) == sequence) && (sequence == record.sequence);
+}
+
+void SpinTimerTrace::init(void* memory, uint64_t capacity)
+{
+  m_header = new (memory) SpinTimerTraceHeader();
+  memcpy(m_header->magic, "SPTTRACE", sizeof(m_header->magic));
+  m_header->version = VERSION;
+  m_header->recordSize = sizeof(SpinTimerTraceRecord);
+  m_header->capacity = capacity;
+  m_header->ticksPerMilli = SPINTIMER_TICKS_PER_MILLI;
+  m_header->writeIndex.store(0, std::memory_order_relaxed);
+  m_records = reinterpret_cast<SpinTimerTraceRecord*>(static_cast<unsigned char*>(memory) + sizeof(SpinTimerTraceHeader));
+  m_mask = capacity - 1;
+}
+
+uint64_t SpinTimerTrace::roundUp(unsigned long capacity)
+{
+  uint64_t records = 1;
+  while (records < capacity)
+  {
+    records <<= 1;
+  }
+  return records;
+}
+
+uint64_t SpinTimerTrace::size(uint64_t capacity)
+{
+  return sizeof(SpinTimerTraceHeader) + capacity * sizeof(SpinTimerTraceRecord);
+}
+
+void SpinTimerTrace::waitForEmitters()
+{
+  while (0 != s_emitters.load(std::memory_order_acquire))
+  {
+    std::this_thread::yield();
+  }
+}
+
+#endif
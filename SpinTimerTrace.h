@@ -0,0 +1,236 @@
+/*
+ * SpinTimerTrace.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERTRACE_H_
+#define SPINTIMERTRACE_H_
+
+#include "SpinTimerTick.h"
+
+/**
+ * Event trace configuration, selected at compile time.
+ *
+ * - default: no events are traced, the trace hooks compile to nothing
+ * - SPINTIMER_TRACE defined (not available on Arduino): SpinTimer::start(), cancel(), the timer expirations and
+ *   SpinTimerContext::handleTick() write records into the installed SpinTimerTrace buffer (@see SpinTimerTrace::install());
+ *   the CMake build provides the SpinTimerTrace library variant
+ */
+#if defined(SPINTIMER_TRACE) && !defined(ARDUINO)
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Fixed size binary trace record.
+ */
+struct SpinTimerTraceRecord
+{
+  uint64_t timeTicks;  /// Up-time of the event [ticks].
+  uint64_t object;     /// Address of the SpinTimer (start, cancel, expire) or SpinTimerContext (tick begin / end).
+  uint64_t value;      /// Event specific value: interval time [ticks] (start), overrun count (expire), 0 otherwise.
+  uint32_t event;      /// SpinTimerTrace::Event
+  uint32_t sequence;   /// Lower 32 bits of the record index + 1, 0: record is being written.
+};
+
+/**
+ * Trace buffer header, followed by the records ring.
+ */
+struct SpinTimerTraceHeader
+{
+  char magic[8];                      /// "SPTTRACE"
+  uint32_t version;                   /// Layout version, @see SpinTimerTrace::VERSION.
+  uint32_t recordSize;                /// sizeof(SpinTimerTraceRecord)
+  uint64_t capacity;                  /// Number of records of the ring, power of 2.
+  uint64_t ticksPerMilli;             /// Time base of the records, @see SPINTIMER_TICKS_PER_MILLI.
+  std::atomic<uint64_t> writeIndex;   /// Index of the next record to be written (number of records written so far).
+};
+
+/**
+ * Flight recorder for timer events.
+ *
+ * Features:
+ * - fixed size binary records (@see SpinTimerTraceRecord) written into a lock-free ring buffer: each event reserves
+ *   its record by an atomic increment of the write index, any thread may write; the oldest records get overwritten
+ * - uninstalling and destroying the buffer waits for the records being written by other threads, the buffer is
+ *   released only when no thread writes to it anymore
+ * - the buffer is either allocated on the heap or mapped to a file (POSIX), so the latest events survive a crash
+ *   of the process
+ * - the recorded file is converted to Chrome trace / Perfetto JSON by the tools/SpinTimerTraceConverter program
+ *
+ * Integration:
+ *
+ *       SpinTimerTrace trace("/var/tmp/timers.trace", 65536);
+ *       trace.install();
+ */
+class SpinTimerTrace
+{
+public:
+  /**
+   * Traced events.
+   */
+  enum Event
+  {
+    EVENT_START      = 1,  /// SpinTimer::start(), value: interval time [ticks].
+    EVENT_CANCEL     = 2,  /// SpinTimer::cancel()
+    EVENT_EXPIRE     = 3,  /// Timer expired, value: overrun count.
+    EVENT_TICK_BEGIN = 4,  /// SpinTimerContext::handleTick() begins.
+    EVENT_TICK_END   = 5   /// SpinTimerContext::handleTick() ends.
+  };
+
+  /**
+   * Constructor, allocates the buffer on the heap.
+   * @param capacity Number of records to be kept, gets rounded up to a power of 2.
+   */
+  SpinTimerTrace(unsigned long capacity);
+
+  /**
+   * Constructor, maps the buffer to a file, which gets created or truncated (POSIX).
+   * @param path File path.
+   * @param capacity Number of records to be kept, gets rounded up to a power of 2.
+   */
+  SpinTimerTrace(const char* path, unsigned long capacity);
+
+  /**
+   * Destructor, uninstalls the buffer if it is installed and waits for the records being written.
+   */
+  virtual ~SpinTimerTrace();
+
+  /**
+   * Indicates whether the buffer is available, mapping a file may fail.
+   * @return true if the buffer is available.
+   */
+  bool isOpen() const;
+
+  /**
+   * Make this buffer the one the trace hooks write to.
+   */
+  void install();
+
+  /**
+   * Stop tracing, the trace hooks do not write anymore; returns when the records being written have been completed.
+   */
+  static void uninstall();
+
+  /**
+   * Installed buffer accessor method.
+   * @return SpinTimerTrace object pointer or 0 if no buffer is installed.
+   */
+  static SpinTimerTrace* installed();
+
+  /**
+   * Write a record to the installed buffer, does nothing if no buffer is installed. Called by the trace hooks.
+   * @param event Event
+   * @param object Address of the SpinTimer or SpinTimerContext.
+   * @param timeTicks Up-time of the event [ticks].
+   * @param value Event specific value.
+   */
+  static inline void emit(Event event, const void* object, SpinTimerTick timeTicks, uint64_t value)
+  {
+    if (0 == s_installed.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+    // announce the write before the buffer gets loaded, uninstall() waits for it
+    s_emitters.fetch_add(1, std::memory_order_seq_cst);
+    SpinTimerTrace* trace = s_installed.load(std::memory_order_seq_cst);
+    if (0 != trace)
+    {
+      trace->record(event, object, timeTicks, value);
+    }
+    s_emitters.fetch_sub(1, std::memory_order_release);
+  }
+
+  /**
+   * Write a record, may be called by any thread.
+   * @param event Event
+   * @param object Address of the SpinTimer or SpinTimerContext.
+   * @param timeTicks Up-time of the event [ticks].
+   * @param value Event specific value.
+   */
+  inline void record(Event event, const void* object, SpinTimerTick timeTicks, uint64_t value)
+  {
+    uint64_t index = m_header->writeIndex.fetch_add(1, std::memory_order_relaxed);
+    SpinTimerTraceRecord& record = m_records[index & m_mask];
+    // sequence lock, a reader detects records being written or overwritten meanwhile
+    __atomic_store_n(&record.sequence, 0, __ATOMIC_RELAXED);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.timeTicks = timeTicks;
+    record.object = reinterpret_cast<uintptr_t>(object);
+    record.value = value;
+    record.event = event;
+    __atomic_store_n(&record.sequence, static_cast<uint32_t>(index + 1), __ATOMIC_RELEASE);
+  }
+
+  /**
+   * Number of records written so far, including the overwritten ones.
+   * @return Write index.
+   */
+  uint64_t count() const;
+
+  /**
+   * Number of records the ring keeps.
+   * @return Capacity, power of 2.
+   */
+  uint64_t capacity() const;
+
+  /**
+   * Read a record.
+   * @param index Record index, count() - capacity() .. count() - 1 are available.
+   * @param record Record read.
+   * @return true if the record has been read, false if it has been overwritten or is being written.
+   */
+  bool read(uint64_t index, SpinTimerTraceRecord& record) const;
+
+public:
+  /**
+   * Current layout version of the buffer.
+   */
+  static const uint32_t VERSION = 1;
+
+private:
+  /**
+   * Set up the header and the records of a zeroed buffer.
+   * @param memory Buffer, at least size(capacity) bytes.
+   * @param capacity Number of records, power of 2.
+   */
+  void init(void* memory, uint64_t capacity);
+
+  /**
+   * Round up to a power of 2.
+   * @param capacity Requested number of records.
+   * @return Number of records.
+   */
+  static uint64_t roundUp(unsigned long capacity);
+
+  /**
+   * Size of a buffer.
+   * @param capacity Number of records.
+   * @return Size [bytes].
+   */
+  static uint64_t size(uint64_t capacity);
+
+  /**
+   * Wait until no thread writes a record anymore.
+   */
+  static void waitForEmitters();
+
+private:
+  static std::atomic<SpinTimerTrace*> s_installed;  /// Buffer the trace hooks write to, 0: none.
+  static std::atomic<unsigned long> s_emitters;     /// Number of threads writing a record to the installed buffer.
+  SpinTimerTraceHeader* m_header;    /// Buffer header, 0: not available.
+  SpinTimerTraceRecord* m_records;   /// Records ring.
+  uint64_t m_mask;                   /// Capacity - 1
+  unsigned char* m_memory;           /// Heap allocated buffer, 0: file mapped.
+  uint64_t m_mappedSize;             /// Size of the file mapping [bytes].
+
+private: // forbidden functions
+  SpinTimerTrace(const SpinTimerTrace& src);              // copy constructor
+  SpinTimerTrace& operator = (const SpinTimerTrace& src); // assignment operator
+};
+
+#endif
+
+#endif /* SPINTIMERTRACE_H_ */
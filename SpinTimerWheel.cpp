@@ -0,0 +1,294 @@
+/*
+ * SpinTimerWheel.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerWheel.h"
+#include "SpinTimerContext.h"
+
+const unsigned int SpinTimerWheel::SLOT_BITS;
+const unsigned int SpinTimerWheel::SLOTS;
+const unsigned int SpinTimerWheel::LEVELS;
+const unsigned int SpinTimerWheel::TAG_PENDING;
+const unsigned int SpinTimerWheel::TAG_EXPIRED;
+const unsigned int SpinTimerWheel::TAG_SLOT;
+
+SpinTimerWheel::SpinTimerWheel()
+: m_timeTicks(0)
+, m_count(0)
+, m_pending(0)
+, m_expired(0)
+{
+  reset(0);
+}
+
+SpinTimerWheel::~SpinTimerWheel()
+{ }
+
+void SpinTimerWheel::reset(SpinTimerTick nowTicks)
+{
+  m_timeTicks = nowTicks;
+  m_count = 0;
+  for (unsigned int level = 0; level < LEVELS; level++)
+  {
+    m_occupied[level] = 0;
+    for (unsigned int slot = 0; slot < SLOTS; slot++)
+    {
+      m_slots[level][slot] = 0;
+    }
+  }
+  m_pending = 0;
+  m_expired = 0;
+}
+
+void SpinTimerWheel::schedule(SpinTimer* timer)
+{
+  unschedule(timer);
+
+  SpinTimerTick leftTicks = remainingTicks(timer, m_timeTicks);
+  if (0 == leftTicks)
+  {
+    // the current slot has already been collected
+    listAppend(m_pending, timer, TAG_PENDING);
+  }
+  else
+  {
+    insert(timer, leftTicks);
+  }
+}
+
+void SpinTimerWheel::unschedule(SpinTimer* timer)
+{
+  unsigned int tag = engineTag(timer);
+  if (TAG_PENDING == tag)
+  {
+    listRemove(m_pending, timer);
+  }
+  else if (TAG_EXPIRED == tag)
+  {
+    listRemove(m_expired, timer);
+  }
+  else if (TAG_SLOT <= tag)
+  {
+    unsigned int level = (tag - TAG_SLOT) / SLOTS;
+    unsigned int slot  = (tag - TAG_SLOT) % SLOTS;
+    listRemove(m_slots[level][slot], timer);
+    if (0 == m_slots[level][slot])
+    {
+      m_occupied[level] &= ~(1ULL << slot);
+    }
+    m_count--;
+  }
+}
+
+void SpinTimerWheel::handleTick(SpinTimerTick nowTicks)
+{
+  if ((nowTicks == m_timeTicks) && (0 == m_pending))
+  {
+    // nothing can be due
+    return;
+  }
+
+  // collect the due timers
+  while (0 != m_pending)
+  {
+    SpinTimer* timer = m_pending;
+    listRemove(m_pending, timer);
+    listAppend(m_expired, timer, TAG_EXPIRED);
+  }
+  advance(nowTicks);
+
+  // dispatch, a recurring timer will be re-scheduled relative to nowTicks
+  while (0 != m_expired)
+  {
+    SpinTimer* timer = m_expired;
+    listRemove(m_expired, timer);
+    expire(timer, nowTicks);
+  }
+}
+
+SpinTimerTick SpinTimerWheel::nextExpiryTicks(SpinTimerTick nowTicks)
+{
+  if ((0 != m_pending) || (0 != m_expired))
+  {
+    return 0;
+  }
+
+  // the start of the next occupied slot of each level is a lower bound for the expiration of its timers
+  const unsigned int timeBits = sizeof(SpinTimerTick) * CHAR_BIT;
+  unsigned long long nextTicks = ~0ULL;
+  for (unsigned int level = 0; level < LEVELS; level++)
+  {
+    if (0 == m_occupied[level])
+    {
+      continue;
+    }
+    unsigned int shift = SLOT_BITS * level;
+    unsigned int slots = (shift + SLOT_BITS > timeBits) ? (1U << (timeBits - shift)) : SLOTS;
+    unsigned int current = (m_timeTicks >> shift) & (slots - 1);
+    for (unsigned int distance = 1; distance <= slots; distance++)
+    {
+      if (0 != (m_occupied[level] & (1ULL << ((current + distance) & (slots - 1)))))
+      {
+        unsigned long long slotTicks = (static_cast<unsigned long long>(distance) << shift) - (m_timeTicks & ((1ULL << shift) - 1));
+        if (slotTicks < nextTicks)
+        {
+          nextTicks = slotTicks;
+        }
+        break;
+      }
+    }
+  }
+
+  if (~0ULL == nextTicks)
+  {
+    return SpinTimerContext::NO_EXPIRY_TICKS;
+  }
+  SpinTimerTick elapsedTicks = nowTicks - m_timeTicks;
+  if (static_cast<SpinTimerTickDiff>(elapsedTicks) < 0)
+  {
+    // the time base went backwards, the wheel gets re-synchronized by the next handleTick() call
+    elapsedTicks = 0;
+  }
+  if (nextTicks <= elapsedTicks)
+  {
+    return 0;
+  }
+  nextTicks -= elapsedTicks;
+  return (nextTicks >= SPINTIMER_TICK_MAX) ? SPINTIMER_TICK_MAX - 1 : static_cast<SpinTimerTick>(nextTicks);
+}
+
+void SpinTimerWheel::insert(SpinTimer* timer, SpinTimerTick leftTicks)
+{
+  if (static_cast<unsigned long long>(leftTicks) >= (1ULL << (SLOT_BITS * LEVELS)))
+  {
+    // beyond the top level, the timer will be re-distributed with the cascade
+    leftTicks = static_cast<SpinTimerTick>((1ULL << (SLOT_BITS * LEVELS)) - 1);
+  }
+
+  unsigned int level = 0;
+  while ((level < LEVELS - 1) && (0 != (leftTicks >> (SLOT_BITS * (level + 1)))))
+  {
+    level++;
+  }
+  SpinTimerTick expiryTicks = m_timeTicks + leftTicks;
+  unsigned int slot = (expiryTicks >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+  listAppend(m_slots[level][slot], timer, TAG_SLOT + level * SLOTS + slot);
+  m_occupied[level] |= (1ULL << slot);
+  m_count++;
+}
+
+void SpinTimerWheel::advance(SpinTimerTick nowTicks)
+{
+  if (static_cast<SpinTimerTickDiff>(nowTicks - m_timeTicks) < 0)
+  {
+    // the time base went backwards (i.e. another up-time adapter has been installed): no time has passed
+    resync(nowTicks);
+    return;
+  }
+
+  SpinTimerTick stepsLeft = nowTicks - m_timeTicks;
+  while (0 != stepsLeft)
+  {
+    if (0 == m_count)
+    {
+      m_timeTicks = nowTicks;
+      return;
+    }
+
+    // find next occupied level 0 slot within the current revolution, otherwise go to the next revolution
+    unsigned int slot = m_timeTicks & (SLOTS - 1);
+    SpinTimerTick step = SLOTS - slot;
+    unsigned long long ahead = (slot < SLOTS - 1) ? (m_occupied[0] & (~0ULL << (slot + 1))) : 0;
+    if (0 != ahead)
+    {
+      step = __builtin_ctzll(ahead) - slot;
+    }
+
+    if (step > stepsLeft)
+    {
+      m_timeTicks = nowTicks;
+      return;
+    }
+
+    m_timeTicks += step;
+    stepsLeft -= step;
+    slot = m_timeTicks & (SLOTS - 1);
+    if (0 == slot)
+    {
+      cascade(1);
+    }
+    collect(slot);
+  }
+}
+
+void SpinTimerWheel::resync(SpinTimerTick nowTicks)
+{
+  SpinTimer* timers = 0;
+  for (unsigned int level = 0; level < LEVELS; level++)
+  {
+    for (unsigned int slot = 0; slot < SLOTS; slot++)
+    {
+      while (0 != m_slots[level][slot])
+      {
+        SpinTimer* timer = m_slots[level][slot];
+        listRemove(m_slots[level][slot], timer);
+        listAppend(timers, timer, TAG_PENDING);
+      }
+    }
+    m_occupied[level] = 0;
+  }
+  m_count = 0;
+  m_timeTicks = nowTicks;
+
+  while (0 != timers)
+  {
+    SpinTimer* timer = timers;
+    listRemove(timers, timer);
+    SpinTimerTick leftTicks = remainingTicks(timer, m_timeTicks);
+    if (0 == leftTicks)
+    {
+      listAppend(m_pending, timer, TAG_PENDING);
+    }
+    else
+    {
+      insert(timer, leftTicks);
+    }
+  }
+}
+
+void SpinTimerWheel::cascade(unsigned int level)
+{
+  unsigned int slot = (m_timeTicks >> (SLOT_BITS * level)) & (SLOTS - 1);
+  if ((0 == slot) && (level < LEVELS - 1))
+  {
+    cascade(level + 1);
+  }
+
+  SpinTimer* list = m_slots[level][slot];
+  m_slots[level][slot] = 0;
+  m_occupied[level] &= ~(1ULL << slot);
+  while (0 != list)
+  {
+    SpinTimer* timer = list;
+    listRemove(list, timer);
+    m_count--;
+    // timers due right now end up in the current level 0 slot, which is collected next
+    insert(timer, remainingTicks(timer, m_timeTicks));
+  }
+}
+
+void SpinTimerWheel::collect(unsigned int slot)
+{
+  while (0 != m_slots[0][slot])
+  {
+    SpinTimer* timer = m_slots[0][slot];
+    listRemove(m_slots[0][slot], timer);
+    listAppend(m_expired, timer, TAG_EXPIRED);
+    m_count--;
+  }
+  m_occupied[0] &= ~(1ULL << slot);
+}
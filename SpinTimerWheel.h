@@ -0,0 +1,110 @@
+/*
+ * SpinTimerWheel.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERWHEEL_H_
+#define SPINTIMERWHEEL_H_
+
+#include "SpinTimerEngine.h"
+
+/**
+ * Hierarchical Timing Wheel, SpinTimerEngine implementation.
+ *
+ * Features:
+ * - running timers are kept in buckets (slots) of a hierarchy of wheels, each level covering a 64 times
+ *   larger time span with the same number of slots, the lowest level having a resolution of 1 tick (1 ms by default, @see SpinTimerTick.h)
+ * - start, cancel and expiration of a timer are O(1), timers of a higher level slot get re-distributed
+ *   to the lower levels (cascaded) when the time of their slot has come
+ * - handleTick() only touches the slots whose time has come, empty slots are skipped with the help of
+ *   per level occupation bitmaps; the cost of a handleTick() call is independent of the number of timers
+ *   not being due
+ * - handles time base overflows correctly; a time base going backwards (i.e. another up-time adapter being installed)
+ *   is taken as no time having passed, the timers keep their deadlines
+ *
+ * Integration:
+ *
+ *       SpinTimerContext::instance()->setEngine(new SpinTimerWheel());
+ *
+ * Memory footprint: 384 slot pointers, intended for systems running a high number of timers.
+ */
+class SpinTimerWheel : public SpinTimerEngine
+{
+public:
+  /**
+   * Constructor.
+   */
+  SpinTimerWheel();
+
+  /**
+   * Destructor.
+   */
+  virtual ~SpinTimerWheel();
+
+  // SpinTimerEngine interface
+  void reset(SpinTimerTick nowTicks);
+  void schedule(SpinTimer* timer);
+  void unschedule(SpinTimer* timer);
+  void handleTick(SpinTimerTick nowTicks);
+  SpinTimerTick nextExpiryTicks(SpinTimerTick nowTicks);
+
+private:
+  /**
+   * Put timer into the slot matching its remaining time.
+   * @param timer SpinTimer object pointer.
+   * @param leftTicks Time left until the timer expires, seen from the wheel's current time [ticks].
+   */
+  void insert(SpinTimer* timer, SpinTimerTick leftTicks);
+
+  /**
+   * Advance the wheel's current time step by step up to nowTicks, skipping empty slots.
+   * The timers of all the slots passed through get moved to the expired list; a nowTicks earlier than the wheel's
+   * current time does not let any timer expire, the wheel gets re-synchronized (@see resync()).
+   * @param nowTicks Current up-time [ticks].
+   */
+  void advance(SpinTimerTick nowTicks);
+
+  /**
+   * Re-distribute all the timers kept in the slots relative to a new current time of the wheel, i.e. after the time
+   * base went backwards; the timers keep their deadlines.
+   * @param nowTicks New current time of the wheel [ticks].
+   */
+  void resync(SpinTimerTick nowTicks);
+
+  /**
+   * Re-distribute the timers of the current slot of the specified level to the lower levels.
+   * @param level Wheel level, 1 .. LEVELS - 1.
+   */
+  void cascade(unsigned int level);
+
+  /**
+   * Move the timers of the specified level 0 slot to the expired list.
+   * @param slot Slot index.
+   */
+  void collect(unsigned int slot);
+
+public:
+  static const unsigned int SLOT_BITS = 6;                  /// Number of bits of the time resolved by each level.
+  static const unsigned int SLOTS     = 1 << SLOT_BITS;     /// Number of slots per level.
+  static const unsigned int LEVELS    = 6;                  /// Number of levels, covering 2^36 ticks.
+
+private:
+  static const unsigned int TAG_PENDING = 1;  /// Timer was due already when scheduled, will be dispatched with next handleTick().
+  static const unsigned int TAG_EXPIRED = 2;  /// Timer is going to be dispatched by the running handleTick().
+  static const unsigned int TAG_SLOT    = 3;  /// Tag of the first slot, tag = TAG_SLOT + level * SLOTS + slot.
+
+  SpinTimerTick m_timeTicks;                      /// Current time of the wheel, up to which all timers have been collected.
+  unsigned long m_count;                           /// Number of timers being kept in the slots.
+  unsigned long long m_occupied[LEVELS];           /// Per level bitmap of the slots containing timers.
+  SpinTimer* m_slots[LEVELS][SLOTS];               /// Per level slot lists heads.
+  SpinTimer* m_pending;                            /// Timers to be dispatched with next handleTick().
+  SpinTimer* m_expired;                            /// Timers to be dispatched by the running handleTick().
+
+private: // forbidden functions
+  SpinTimerWheel(const SpinTimerWheel& src);              // copy constructor
+  SpinTimerWheel& operator = (const SpinTimerWheel& src); // assignment operator
+};
+
+#endif /* SPINTIMERWHEEL_H_ */
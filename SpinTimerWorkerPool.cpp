@@ -0,0 +1,152 @@
+/*
+ * SpinTimerWorkerPool.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "SpinTimerWorkerPool.h"
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+
+SpinTimerWorkerPool::SpinTimerWorkerPool(unsigned int numOfWorkers)
+: m_nextWorker(0)
+, m_pending(0)
+, m_sleeping(0)
+, m_isStopping(false)
+{
+  if (0 == numOfWorkers)
+  {
+    numOfWorkers = std::thread::hardware_concurrency();
+  }
+  if (0 == numOfWorkers)
+  {
+    numOfWorkers = 1;
+  }
+
+  for (unsigned int i = 0; i < numOfWorkers; i++)
+  {
+    m_workers.push_back(new Worker());
+  }
+  for (unsigned int i = 0; i < numOfWorkers; i++)
+  {
+    m_workers[i]->thread = std::thread(&SpinTimerWorkerPool::work, this, i);
+  }
+}
+
+SpinTimerWorkerPool::~SpinTimerWorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_idleMutex);
+    m_isStopping = true;
+  }
+  m_idle.notify_all();
+
+  // the queues are deleted only after all the workers have ended, a worker may still be stealing from any of them
+  for (unsigned int i = 0; i < m_workers.size(); i++)
+  {
+    m_workers[i]->thread.join();
+  }
+  for (unsigned int i = 0; i < m_workers.size(); i++)
+  {
+    delete m_workers[i];
+  }
+}
+
+unsigned int SpinTimerWorkerPool::numOfWorkers() const
+{
+  return m_workers.size();
+}
+
+void SpinTimerWorkerPool::dispatch(SpinTimer* timers)
+{
+  long count = 0;
+  while (0 != timers)
+  {
+    SpinTimer* timer = timers;
+    timers = next(timer);
+
+    Worker* worker = m_workers[m_nextWorker];
+    m_nextWorker = (m_nextWorker + 1) % m_workers.size();
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->queue.push_back(timer);
+    }
+    count++;
+  }
+  if (0 == count)
+  {
+    return;
+  }
+
+  // workers go idle only after having seen m_pending at 0 while being counted in m_sleeping, so either they see the
+  // new timers or they get notified; the mutex is only taken if a worker is idle
+  m_pending.fetch_add(count);
+  if (0 != m_sleeping.load())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_idleMutex);
+    }
+    if (1 == count)
+    {
+      m_idle.notify_one();
+    }
+    else
+    {
+      m_idle.notify_all();
+    }
+  }
+}
+
+void SpinTimerWorkerPool::work(unsigned int index)
+{
+  for (;;)
+  {
+    SpinTimer* timer = take(index);
+    if (0 != timer)
+    {
+      run(timer);
+      continue;
+    }
+
+    // all queues are empty
+    std::unique_lock<std::mutex> lock(m_idleMutex);
+    m_sleeping.fetch_add(1);
+    m_idle.wait(lock, [this]() { return (m_pending.load() > 0) || m_isStopping; });
+    m_sleeping.fetch_sub(1);
+    if (m_isStopping && (m_pending.load() <= 0))
+    {
+      // all the timers handed over have been taken
+      return;
+    }
+  }
+}
+
+SpinTimer* SpinTimerWorkerPool::take(unsigned int index)
+{
+  // own queue first, then steal from the tail of the other workers' queues
+  for (unsigned int i = 0; i < m_workers.size(); i++)
+  {
+    Worker* worker = m_workers[(index + i) % m_workers.size()];
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    if (!worker->queue.empty())
+    {
+      SpinTimer* timer = 0;
+      if (0 == i)
+      {
+        timer = worker->queue.front();
+        worker->queue.pop_front();
+      }
+      else
+      {
+        timer = worker->queue.back();
+        worker->queue.pop_back();
+      }
+      m_pending.fetch_sub(1);
+      return timer;
+    }
+  }
+  return 0;
+}
+
+#endif
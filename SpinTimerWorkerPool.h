@@ -0,0 +1,104 @@
+/*
+ * SpinTimerWorkerPool.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef SPINTIMERWORKERPOOL_H_
+#define SPINTIMERWORKERPOOL_H_
+
+#include "SpinTimerDispatcher.h"
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Work stealing thread pool, SpinTimerDispatcher implementation.
+ *
+ * Features:
+ * - runs the actions of the expired timers on a fixed number of worker threads, the thread kicking the
+ *   SpinTimerContext only detects the expirations and hands the timers over
+ * - each worker has its own queue with its own lock, the handed over timers are distributed round robin;
+ *   a worker whose queue is empty steals timers from the tail of the other workers' queues
+ * - the workers only wait on a condition variable when all the queues are empty, the number of timers not taken yet
+ *   is kept in an atomic counter; handing over and taking timers does not touch any lock shared by all the workers
+ * - the actions of one timer never run concurrently and keep the order of the expirations
+ *
+ * Integration:
+ *
+ *       SpinTimerWorkerPool pool(4);
+ *       SpinTimerContext::instance()->setDispatcher(&pool);
+ *
+ * The actions run on the worker threads, they have to be thread safe with regard to the rest of the application;
+ * a timer's action must not be changed while the timer is running.
+ * Only available if SPINTIMER_CROSS_THREAD_CONTROL is defined.
+ */
+class SpinTimerWorkerPool : public SpinTimerDispatcher
+{
+public:
+  /**
+   * Constructor, starts the worker threads.
+   * @param numOfWorkers Number of worker threads, 0: number of hardware threads.
+   */
+  SpinTimerWorkerPool(unsigned int numOfWorkers = 0);
+
+  /**
+   * Destructor, runs the timers handed over so far and stops the worker threads.
+   */
+  virtual ~SpinTimerWorkerPool();
+
+  /**
+   * Number of worker threads.
+   * @return Number of worker threads.
+   */
+  unsigned int numOfWorkers() const;
+
+  // SpinTimerDispatcher interface
+  void dispatch(SpinTimer* timers);
+
+private:
+  /**
+   * Worker thread main loop.
+   * @param index Worker index.
+   */
+  void work(unsigned int index);
+
+  /**
+   * Take a timer from the head of the worker's own queue, or steal one from the tail of another worker's queue.
+   * Counts m_pending down.
+   * @param index Worker index.
+   * @return SpinTimer object pointer, 0 if all queues are empty.
+   */
+  SpinTimer* take(unsigned int index);
+
+private:
+  struct Worker
+  {
+    std::mutex mutex;             /// Protects the queue.
+    std::deque<SpinTimer*> queue; /// Timers handed over to this worker.
+    std::thread thread;           /// Worker thread.
+  };
+
+  std::vector<Worker*> m_workers;   /// Workers.
+  unsigned int m_nextWorker;        /// Worker to get the next timer handed over, round robin.
+  std::atomic<long> m_pending;      /// Number of timers handed over and not taken yet, may drop below 0 for a moment while a timer gets taken before being counted.
+  std::atomic<unsigned int> m_sleeping; /// Number of workers going idle or waiting for timers.
+  std::mutex m_idleMutex;           /// Protects m_isStopping, taken only while workers go idle or get woken up.
+  std::condition_variable m_idle;   /// Idle workers wait for timers.
+  bool m_isStopping;                /// The pool is being destroyed.
+
+private: // forbidden functions
+  SpinTimerWorkerPool(const SpinTimerWorkerPool& src);              // copy constructor
+  SpinTimerWorkerPool& operator = (const SpinTimerWorkerPool& src); // assignment operator
+};
+
+#endif
+
+#endif /* SPINTIMERWORKERPOOL_H_ */
@@ -0,0 +1,99 @@
+/*
+ * TscUptimeInfoAdapter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "TscUptimeInfoAdapter.h"
+
+#if !defined(ARDUINO) && defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+
+#include <time.h>
+#include <cpuid.h>
+#include <x86intrin.h>
+
+// 128 bit intermediate results of the fixed point arithmetic, a GCC/Clang extension on x86-64
+__extension__ typedef unsigned __int128 SpinTimerUint128;
+
+inline unsigned long long TscUptimeInfoAdapter::nanos() const
+{
+  if (m_isInvariant)
+  {
+    // 64 x 32.32 bit fixed point product, the upper 64 bits of the 128 bit result are the nanoseconds
+    unsigned long long cycles = __rdtsc() - m_originCycles;
+    return static_cast<unsigned long long>((static_cast<SpinTimerUint128>(cycles) * m_nanosPerCycle) >> 32);
+  }
+  return monotonicNanos() - m_originCycles;
+}
+
+TscUptimeInfoAdapter::TscUptimeInfoAdapter(unsigned long calibrationMillis)
+: m_isInvariant(false)
+, m_originCycles(0)
+, m_nanosPerCycle(0)
+, m_frequencyHz(0)
+{
+  // invariant TSC: CPUID.80000007H:EDX[8]
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+  bool isInvariant = (0 != __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) && (0 != (edx & (1U << 8)));
+
+  if (isInvariant)
+  {
+    // count the cycles elapsing while the monotonic clock advances by the calibration time
+    unsigned long delayMillis = (0 != calibrationMillis) ? calibrationMillis : 1;
+    struct timespec delay;
+    delay.tv_sec = delayMillis / 1000;
+    delay.tv_nsec = static_cast<long>((delayMillis % 1000) * 1000000L);
+    unsigned long long startNanos = monotonicNanos();
+    unsigned long long startCycles = __rdtsc();
+    nanosleep(&delay, 0);
+    unsigned long long endNanos = monotonicNanos();
+    unsigned long long endCycles = __rdtsc();
+
+    unsigned long long elapsedNanos = endNanos - startNanos;
+    unsigned long long elapsedCycles = endCycles - startCycles;
+    if ((0 != elapsedNanos) && (0 != elapsedCycles))
+    {
+      m_nanosPerCycle = static_cast<unsigned long long>((static_cast<SpinTimerUint128>(elapsedNanos) << 32) / elapsedCycles);
+      m_frequencyHz = static_cast<unsigned long long>(static_cast<SpinTimerUint128>(elapsedCycles) * 1000000000ULL / elapsedNanos);
+      m_isInvariant = (0 != m_nanosPerCycle);
+    }
+  }
+
+  m_originCycles = m_isInvariant ? __rdtsc() : monotonicNanos();
+}
+
+TscUptimeInfoAdapter::~TscUptimeInfoAdapter()
+{ }
+
+unsigned long TscUptimeInfoAdapter::tMillis()
+{
+  return static_cast<unsigned long>(nanos() / 1000000ULL);
+}
+
+SpinTimerTick TscUptimeInfoAdapter::tTicks()
+{
+  return static_cast<SpinTimerTick>(nanos() / (1000000ULL / SPINTIMER_TICKS_PER_MILLI));
+}
+
+bool TscUptimeInfoAdapter::isInvariant() const
+{
+  return m_isInvariant;
+}
+
+unsigned long long TscUptimeInfoAdapter::frequencyHz() const
+{
+  return m_frequencyHz;
+}
+
+unsigned long long TscUptimeInfoAdapter::monotonicNanos()
+{
+  struct timespec tp;
+  clock_gettime(CLOCK_MONOTONIC, &tp);
+  return static_cast<unsigned long long>(tp.tv_sec) * 1000000000ULL + tp.tv_nsec;
+}
+
+#endif
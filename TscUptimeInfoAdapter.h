@@ -0,0 +1,88 @@
+/*
+ * TscUptimeInfoAdapter.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef TSCUPTIMEINFOADAPTER_H_
+#define TSCUPTIMEINFOADAPTER_H_
+
+#if !defined(ARDUINO) && defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+
+#include "UptimeInfo.h"
+
+/**
+ * x86-64 time stamp counter UptimeInfoAdapter implementation.
+ *
+ * Features:
+ * - reads the time stamp counter (rdtsc) without any system call or vDSO indirection, i.e. a few nanoseconds per call
+ * - the counter frequency gets calibrated against clock_gettime(CLOCK_MONOTONIC) by the constructor; the counter
+ *   reading is converted by a fixed point multiplication, no division
+ * - requires an invariant TSC (constant rate, not stopping in deep C-states, synchronized across the cores), which is
+ *   checked with cpuid; without it the adapter falls back to clock_gettime(CLOCK_MONOTONIC), @see isInvariant()
+ * - not affected by system time changes, the time is related to the creation of the adapter object
+ * - provides the up-time in the configured time base resolution (@see SpinTimerTick.h) with tTicks(), used as
+ *   default adapter if SPINTIMER_UPTIME_TSC is defined
+ *
+ * Integration:
+ *
+ *       UptimeInfo::Instance()->setAdapter(new TscUptimeInfoAdapter());
+ */
+class TscUptimeInfoAdapter : public UptimeInfoAdapter
+{
+public:
+  /**
+   * Constructor, calibrates the counter frequency and takes the current counter reading as origin.
+   * @param calibrationMillis Calibration time [ms], the longer the more accurate; default: 10 ms.
+   */
+  TscUptimeInfoAdapter(unsigned long calibrationMillis = 10);
+
+  /**
+   * Destructor.
+   */
+  virtual ~TscUptimeInfoAdapter();
+
+  // UptimeInfoAdapter interface
+  unsigned long tMillis();
+  SpinTimerTick tTicks();
+
+  /**
+   * Indicates whether the processor provides an invariant TSC, otherwise the monotonic clock is read instead.
+   * @return true if the TSC is read.
+   */
+  bool isInvariant() const;
+
+  /**
+   * Calibrated counter frequency.
+   * @return Frequency [Hz], 0 if the TSC is not invariant.
+   */
+  unsigned long long frequencyHz() const;
+
+private:
+  /**
+   * Time since the adapter's creation.
+   * @return Up-time [ns].
+   */
+  inline unsigned long long nanos() const;
+
+  /**
+   * Read the monotonic clock.
+   * @return Time since an unspecified point in the past [ns].
+   */
+  static unsigned long long monotonicNanos();
+
+private:
+  bool m_isInvariant;                 /// TSC is invariant and gets read.
+  unsigned long long m_originCycles;  /// Counter reading (TSC) or monotonic clock time [ns] of the adapter's creation.
+  unsigned long long m_nanosPerCycle; /// Conversion factor, 32.32 fixed point [ns/cycle].
+  unsigned long long m_frequencyHz;   /// Calibrated counter frequency [Hz].
+
+private: // forbidden functions
+  TscUptimeInfoAdapter(const TscUptimeInfoAdapter& src);              // copy constructor
+  TscUptimeInfoAdapter& operator = (const TscUptimeInfoAdapter& src); // assignment operator
+};
+
+#endif
+
+#endif /* TSCUPTIMEINFOADAPTER_H_ */
@@ -5,6 +5,8 @@
  *      Author: niklausd
  */
 #include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "TscUptimeInfoAdapter.h"
 
 #ifdef ARDUINO
 #include "Arduino.h"
@@ -31,17 +33,26 @@ public:
   }
 };
 
-UptimeInfo* UptimeInfo::s_instance = 0;
 UptimeInfoAdapter* UptimeInfo::s_adapter = 0;
 
 UptimeInfo::UptimeInfo()
 {
-  s_adapter = new DefaultUptimeInfoAdapter();
+  // POSIX: monotonic up-time starting near zero, as expected by the 64 bit time base; not affected by system time
+  // changes, so the timers do not expire wrongly when the wall clock gets adjusted
+#if defined(SPINTIMER_UPTIME_TSC) && !defined(ARDUINO) && defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+  static TscUptimeInfoAdapter s_defaultAdapter;
+#elif defined(SPINTIMER_UPTIME_COARSE) && !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+  static MonotonicUptimeInfoAdapter s_defaultAdapter(MonotonicUptimeInfoAdapter::COARSE);
+#elif !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+  static MonotonicUptimeInfoAdapter s_defaultAdapter;
+#else
+  static DefaultUptimeInfoAdapter s_defaultAdapter;
+#endif
+  s_adapter = &s_defaultAdapter;
 }
 
 UptimeInfo::~UptimeInfo()
 {
-  delete s_adapter;
   s_adapter = 0;
 }
 
@@ -8,6 +8,8 @@
 #ifndef UPTIMEINFO_H_
 #define UPTIMEINFO_H_
 
+#include "SpinTimerTick.h"
+
 /**
  * Adapter Interface, will call-out the platform specific up-time info time in milliseconds.
  */
@@ -20,6 +22,16 @@ public:
    */
   virtual unsigned long tMillis() = 0;
 
+  /**
+   * Up-time query call-out in the configured time base resolution (@see SpinTimerTick.h).
+   * To be overridden by adapters providing a higher resolution than milliseconds.
+   * @return Number of ticks since the program started, default: tMillis() scaled to ticks.
+   */
+  virtual SpinTimerTick tTicks()
+  {
+    return static_cast<SpinTimerTick>(tMillis()) * SPINTIMER_TICKS_PER_MILLI;
+  }
+
 protected:
   UptimeInfoAdapter() { }
 
@@ -41,13 +53,14 @@ private:  // forbidden functions
 class UptimeInfo
 {
 public:
+  /**
+   * Create and/or return singleton instance of UptimeInfo (statically allocated, no heap memory is used).
+   * @return Pointer to singleton UptimeInfo object.
+   */
   static inline UptimeInfo* Instance()
   {
-    if (0 == s_instance)
-    {
-      s_instance = new UptimeInfo();
-    }
-    return s_instance;
+    static UptimeInfo s_instance;
+    return &s_instance;
   }
 
 protected:
@@ -77,9 +90,26 @@ public:
     return ms;
   }
 
+  /**
+   * Returns the up-time in the configured time base resolution (@see SpinTimerTick.h).
+   * @return Number of ticks since the program started.
+   */
+  static inline SpinTimerTick tTicks()
+  {
+    SpinTimerTick ticks = 0;
+    if (0 != adapter())
+    {
+#if SPINTIMER_TICK_WRAPAROUND
+      // millisecond time base, take the adapter's up-time as it is
+      ticks = adapter()->tMillis();
+#else
+      ticks = adapter()->tTicks();
+#endif
+    }
+    return ticks;
+  }
 
 private:
-  static UptimeInfo*        s_instance;
   static UptimeInfoAdapter* s_adapter;
 
 private: // forbidden functions
@@ -0,0 +1,40 @@
+/*
+ * VirtualUptimeInfoAdapter.cpp
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#include "VirtualUptimeInfoAdapter.h"
+
+VirtualUptimeInfoAdapter::VirtualUptimeInfoAdapter(SpinTimerTick timeTicks)
+: m_timeTicks(timeTicks)
+{ }
+
+VirtualUptimeInfoAdapter::~VirtualUptimeInfoAdapter()
+{ }
+
+unsigned long VirtualUptimeInfoAdapter::tMillis()
+{
+  return static_cast<unsigned long>(m_timeTicks / SPINTIMER_TICKS_PER_MILLI);
+}
+
+SpinTimerTick VirtualUptimeInfoAdapter::tTicks()
+{
+  return m_timeTicks;
+}
+
+void VirtualUptimeInfoAdapter::setTicks(SpinTimerTick timeTicks)
+{
+  m_timeTicks = timeTicks;
+}
+
+void VirtualUptimeInfoAdapter::advanceTicks(SpinTimerTick deltaTicks)
+{
+  m_timeTicks += deltaTicks;
+}
+
+void VirtualUptimeInfoAdapter::advanceMillis(unsigned long deltaMillis)
+{
+  m_timeTicks += static_cast<SpinTimerTick>(deltaMillis) * SPINTIMER_TICKS_PER_MILLI;
+}
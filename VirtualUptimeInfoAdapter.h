@@ -0,0 +1,71 @@
+/*
+ * VirtualUptimeInfoAdapter.h
+ *
+ *  Created on: 16.10.2026
+ *      Author: niklausd
+ */
+
+#ifndef VIRTUALUPTIMEINFOADAPTER_H_
+#define VIRTUALUPTIMEINFOADAPTER_H_
+
+#include "UptimeInfo.h"
+
+/**
+ * Simulated clock UptimeInfoAdapter implementation.
+ *
+ * Features:
+ * - the up-time only changes when it gets set or advanced explicitly, i.e. by the SpinTimerSimulator
+ * - provides the up-time in the configured time base resolution (@see SpinTimerTick.h) with tTicks(),
+ *   overflows of the time base behave like the ones of a real clock
+ *
+ * Integration:
+ *
+ *       VirtualUptimeInfoAdapter clock;
+ *       UptimeInfo::Instance()->setAdapter(&clock);
+ *       clock.advanceMillis(100);
+ */
+class VirtualUptimeInfoAdapter : public UptimeInfoAdapter
+{
+public:
+  /**
+   * Constructor.
+   * @param timeTicks Initial up-time [ticks], default: 0
+   */
+  VirtualUptimeInfoAdapter(SpinTimerTick timeTicks = 0);
+
+  /**
+   * Destructor.
+   */
+  virtual ~VirtualUptimeInfoAdapter();
+
+  // UptimeInfoAdapter interface
+  unsigned long tMillis();
+  SpinTimerTick tTicks();
+
+  /**
+   * Set the up-time.
+   * @param timeTicks New up-time [ticks].
+   */
+  void setTicks(SpinTimerTick timeTicks);
+
+  /**
+   * Advance the up-time.
+   * @param deltaTicks Time to advance [ticks].
+   */
+  void advanceTicks(SpinTimerTick deltaTicks);
+
+  /**
+   * Advance the up-time.
+   * @param deltaMillis Time to advance [ms].
+   */
+  void advanceMillis(unsigned long deltaMillis);
+
+private:
+  SpinTimerTick m_timeTicks;  /// Current up-time [ticks].
+
+private: // forbidden functions
+  VirtualUptimeInfoAdapter(const VirtualUptimeInfoAdapter& src);              // copy constructor
+  VirtualUptimeInfoAdapter& operator = (const VirtualUptimeInfoAdapter& src); // assignment operator
+};
+
+#endif /* VIRTUALUPTIMEINFOADAPTER_H_ */
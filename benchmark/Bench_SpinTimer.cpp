@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <ctime>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "UptimeInfo.h"
+#include "Bench_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// isExpired() Polling
+
+static void BM_SpinTimer_isExpiredPolling(benchmark::State& state)
+{
+  Bench_UptimeInfo uptimeInfo;
+  UptimeInfoAdapter* previousUptimeInfo = UptimeInfo::adapter();
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  SpinTimer timer(1000, nullptr, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  unsigned long millis = 0;
+
+  for (auto _ : state)
+  {
+    uptimeInfo.setTMillis(++millis);
+    benchmark::DoNotOptimize(timer.isExpired());
+  }
+
+  UptimeInfo::Instance()->setAdapter(previousUptimeInfo);
+}
+BENCHMARK(BM_SpinTimer_isExpiredPolling);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// start() Re-Arm Rate
+
+static void BM_SpinTimer_restart(benchmark::State& state)
+{
+  Bench_UptimeInfo uptimeInfo;
+  UptimeInfoAdapter* previousUptimeInfo = UptimeInfo::adapter();
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  SpinTimer timer(1000, nullptr, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  unsigned long millis = 0;
+
+  for (auto _ : state)
+  {
+    // i.e. a watchdog being fed
+    uptimeInfo.setTMillis(++millis);
+    timer.start();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  UptimeInfo::Instance()->setAdapter(previousUptimeInfo);
+}
+BENCHMARK(BM_SpinTimer_restart);
+
+static void BM_SpinTimer_restartInterval(benchmark::State& state)
+{
+  Bench_UptimeInfo uptimeInfo;
+  UptimeInfoAdapter* previousUptimeInfo = UptimeInfo::adapter();
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  SpinTimer timer(1000, nullptr, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  unsigned long millis = 0;
+
+  for (auto _ : state)
+  {
+    uptimeInfo.setTMillis(++millis);
+    timer.start(1000 + (millis & 0xFF));
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  UptimeInfo::Instance()->setAdapter(previousUptimeInfo);
+}
+BENCHMARK(BM_SpinTimer_restartInterval);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// delayAndSchedule() CPU Burn
+
+static void BM_SpinTimer_delayAndSchedule(benchmark::State& state)
+{
+  // real time base, the delay takes place
+  MonotonicUptimeInfoAdapter uptimeInfo;
+  UptimeInfoAdapter* previousUptimeInfo = UptimeInfo::adapter();
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  std::clock_t cpuStart = std::clock();
+
+  for (auto _ : state)
+  {
+    delayAndSchedule(static_cast<unsigned long>(state.range(0)));
+  }
+
+  // CPU time consumed per wall clock time of the delays, 1.0: busy spinning
+  double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+  double delaySeconds = static_cast<double>(state.iterations() * state.range(0)) / 1000.0;
+  state.counters["cpu_load"] = (delaySeconds > 0) ? cpuSeconds / delaySeconds : 0;
+
+  UptimeInfo::Instance()->setAdapter(previousUptimeInfo);
+}
+BENCHMARK(BM_SpinTimer_delayAndSchedule)->Arg(1)->Arg(10)->UseRealTime();
@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerScan.h"
+#include "SpinTimerWheel.h"
+#include "UptimeInfo.h"
+#include "Bench_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+/**
+ * Keeps a number of timers registered in the SpinTimerContext during a benchmark run, installs the benchmark's
+ * up-time info adapter meanwhile.
+ */
+class RegisteredTimers
+{
+public:
+  RegisteredTimers(long count, unsigned long timeMillis = 1000, bool isRunning = false)
+  : m_previousUptimeInfo(UptimeInfo::adapter())
+  {
+    UptimeInfo::Instance()->setAdapter(&m_uptimeInfo);
+    m_timers.reserve(count);
+    for (long i = 0; i < count; i++)
+    {
+      m_timers.push_back(new SpinTimer(timeMillis, nullptr, SpinTimer::IS_RECURRING, isRunning));
+    }
+  }
+
+  ~RegisteredTimers()
+  {
+    for (size_t i = 0; i < m_timers.size(); i++)
+    {
+      delete m_timers[i];
+    }
+    UptimeInfo::Instance()->setAdapter(m_previousUptimeInfo);
+  }
+
+  Bench_UptimeInfo& uptimeInfo()
+  {
+    return m_uptimeInfo;
+  }
+
+private:
+  UptimeInfoAdapter* m_previousUptimeInfo;
+  Bench_UptimeInfo m_uptimeInfo;
+  std::vector<SpinTimer*> m_timers;
+};
+
+/**
+ * Engine under test, selected by a benchmark argument.
+ */
+enum EngineId
+{
+  ENGINE_NONE,   /// Kick every attached timer (default).
+  ENGINE_HEAP,   /// SpinTimerHeap
+  ENGINE_WHEEL,  /// SpinTimerWheel
+  ENGINE_SCAN    /// SpinTimerScan
+};
+
+/**
+ * Engages the engine under test in the default context for the lifetime of the object.
+ */
+class EngagedEngine
+{
+public:
+  EngagedEngine(long id)
+  : m_engine(0)
+  {
+    switch (id)
+    {
+      case ENGINE_HEAP:  m_engine = new SpinTimerHeap();  break;
+      case ENGINE_WHEEL: m_engine = new SpinTimerWheel(); break;
+      case ENGINE_SCAN:  m_engine = new SpinTimerScan();  break;
+      default: break;
+    }
+    SpinTimerContext::instance()->setEngine(m_engine);
+  }
+
+  ~EngagedEngine()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+    delete m_engine;
+  }
+
+private:
+  SpinTimerEngine* m_engine;
+};
+
+static void EngineArguments(benchmark::internal::Benchmark* benchmark)
+{
+  benchmark->ArgNames({"timers", "engine"});
+  for (long engine = ENGINE_NONE; engine <= ENGINE_SCAN; engine++)
+  {
+    for (long count = 10; count <= 1000000; count *= 10)
+    {
+      benchmark->Args({count, engine});
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Attach / Detach Churn
+
+static void BM_SpinTimerContext_churn(benchmark::State& state)
+{
+  RegisteredTimers registeredTimers(state.range(0));
+
+  for (auto _ : state)
+  {
+    // short-lived one-shot timer, as in delayAndSchedule()
+    SpinTimer timer(10, nullptr, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+    benchmark::DoNotOptimize(&timer);
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_SpinTimerContext_churn)->RangeMultiplier(10)->Range(10, 1000000)->Complexity(benchmark::o1);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// handleTick() Cost
+
+static void BM_SpinTimerContext_handleTickIdle(benchmark::State& state)
+{
+  // running timers, none of them gets due during the run
+  RegisteredTimers registeredTimers(state.range(0), 1000000000UL, SpinTimer::IS_AUTOSTART);
+  EngagedEngine engine(state.range(1));
+  unsigned long millis = 0;
+
+  for (auto _ : state)
+  {
+    registeredTimers.uptimeInfo().setTMillis(++millis);
+    SpinTimerContext::instance()->handleTick();
+  }
+}
+BENCHMARK(BM_SpinTimerContext_handleTickIdle)->Apply(EngineArguments);
+
+static void BM_SpinTimerContext_handleTickAllDue(benchmark::State& state)
+{
+  // recurring timers with an interval of 1 ms, all of them expire with each pass
+  RegisteredTimers registeredTimers(state.range(0), 1, SpinTimer::IS_AUTOSTART);
+  EngagedEngine engine(state.range(1));
+  unsigned long millis = 0;
+
+  for (auto _ : state)
+  {
+    registeredTimers.uptimeInfo().setTMillis(++millis);
+    SpinTimerContext::instance()->handleTick();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpinTimerContext_handleTickAllDue)->Apply(EngineArguments);
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "UptimeInfo.h"
+
+/**
+ * Deterministic time base for the benchmarks, the time only changes when set explicitly.
+ */
+class Bench_UptimeInfo : public UptimeInfoAdapter
+{
+private:
+    unsigned long m_Millis;
+
+public:
+    Bench_UptimeInfo(unsigned long millis = 0) : m_Millis(millis){};
+
+    void setTMillis(unsigned long millis)
+    {
+        m_Millis = millis;
+    };
+
+    // UptimeInfo interface
+    unsigned long tMillis()
+    {
+        return m_Millis;
+    };
+};
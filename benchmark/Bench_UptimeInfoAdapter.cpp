@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include <sys/time.h>
+
+#include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "TscUptimeInfoAdapter.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+/**
+ * Wall clock based adapter, as used by default on POSIX systems before (not monotonic, jumps with NTP); the baseline.
+ */
+class Bench_WallClockUptimeInfo : public UptimeInfoAdapter
+{
+public:
+  unsigned long tMillis()
+  {
+    struct timeval tp;
+    gettimeofday(&tp, 0);
+    return tp.tv_sec * 1000 + tp.tv_usec / 1000;
+  }
+};
+
+/**
+ * Measure the cost of an up-time query through UptimeInfo, as done by the timers on every tick.
+ */
+static void benchmarkUptimeInfo(benchmark::State& state, UptimeInfoAdapter* adapter)
+{
+  UptimeInfoAdapter* previous = UptimeInfo::adapter();
+  UptimeInfo::Instance()->setAdapter(adapter);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(UptimeInfo::tTicks());
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  UptimeInfo::Instance()->setAdapter(previous);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Clock Read Cost
+
+static void BM_UptimeInfo_gettimeofday(benchmark::State& state)
+{
+  Bench_WallClockUptimeInfo adapter;
+  benchmarkUptimeInfo(state, &adapter);
+}
+BENCHMARK(BM_UptimeInfo_gettimeofday);
+
+static void BM_UptimeInfo_monotonic(benchmark::State& state)
+{
+  MonotonicUptimeInfoAdapter adapter;
+  benchmarkUptimeInfo(state, &adapter);
+}
+BENCHMARK(BM_UptimeInfo_monotonic);
+
+static void BM_UptimeInfo_monotonicCoarse(benchmark::State& state)
+{
+  MonotonicUptimeInfoAdapter adapter(MonotonicUptimeInfoAdapter::COARSE);
+  benchmarkUptimeInfo(state, &adapter);
+}
+BENCHMARK(BM_UptimeInfo_monotonicCoarse);
+
+#if defined(__x86_64__)
+static void BM_UptimeInfo_tsc(benchmark::State& state)
+{
+  TscUptimeInfoAdapter adapter;
+  if (!adapter.isInvariant())
+  {
+    state.SkipWithError("no invariant TSC, the monotonic clock would be measured");
+    return;
+  }
+  benchmarkUptimeInfo(state, &adapter);
+  state.counters["tsc_mhz"] = static_cast<double>(adapter.frequencyHz()) / 1e6;
+}
+BENCHMARK(BM_UptimeInfo_tsc);
+#endif
@@ -0,0 +1,6 @@
+#include <benchmark/benchmark.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+BENCHMARK_MAIN();
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "SpinTimer.h"
+
+class CountingSpinTimerAction : public SpinTimerAction
+{
+public:
+    CountingSpinTimerAction() : m_count(0) { }
+
+    unsigned long count() const
+    {
+        return m_count;
+    };
+
+    // SpinTimerAction Interface
+    void timeExpired()
+    {
+        m_count++;
+    };
+
+private:
+    unsigned long m_count;
+};
@@ -8,4 +8,5 @@ class Mock_SpinTimerAction : public SpinTimerAction
 public:
     // SpinTimerAction Interface
     MOCK_METHOD(void, timeExpired, (), (override));
+    MOCK_METHOD(void, timeOverrun, (unsigned long), (override));
 };
@@ -1,14 +1,22 @@
 #pragma once
 
+#include <atomic>
 #include "UptimeInfo.h"
 
 class Mock_UptimeInfo : public UptimeInfoAdapter
 {
 private:
-    unsigned long m_Millis;
+    // atomic, the up-time also gets read by the dispatcher's worker threads (runtime statistics)
+    std::atomic<unsigned long> m_Millis;
+    std::atomic<unsigned long> m_Reads;
 
 public:
-    Mock_UptimeInfo(unsigned long millis = 0) : m_Millis(millis){};
+    Mock_UptimeInfo(unsigned long millis = 0) : m_Millis(millis), m_Reads(0){};
+
+    unsigned long reads() const
+    {
+        return m_Reads;
+    };
 
     void setTMillis(unsigned long millis)
     {
@@ -22,6 +30,7 @@ public:
     // UptimeInfo interface
     unsigned long tMillis()
     {
+        m_Reads++;
         return m_Millis;
     };
 };
@@ -1,12 +1,18 @@
 #include <gtest/gtest.h>
 #include <tuple>
+#include <ctime>
 
 #include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerWheel.h"
 #include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
 #include "Mock_UptimeInfo.h"
 #include "Mock_SpinTimerAction.h"
 
 using ::testing::AtLeast;
+using ::testing::InSequence;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper Classes
@@ -40,6 +46,35 @@ protected:
   SpinTimer timer;
 };
 
+// First: engine (0: none, 1: SpinTimerHeap, 2: SpinTimerWheel) Second: startMillis
+typedef std::tuple<int, unsigned long int> SpinTimerFixedRateTestParam;
+
+class SpinTimerFixedRate : public ::testing::TestWithParam<SpinTimerFixedRateTestParam>
+{
+protected:
+  void SetUp()
+  {
+    uptimeInfo.setTMillis(std::get<1>(GetParam()));
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    SpinTimerEngine* engines[] = { 0, &heap, &wheel };
+    SpinTimerContext::instance()->setEngine(engines[std::get<0>(GetParam())]);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  void advanceTMillis(unsigned long int millis)
+  {
+    uptimeInfo.setTMillis(uptimeInfo.tMillis() + millis);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerHeap heap;
+  SpinTimerWheel wheel;
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Timer Creation Tests
 
@@ -166,6 +201,183 @@ TEST_P(SpinTimerRecurring, timer_recurringTimer_test)
   EXPECT_EQ(uptimeInfo.tMillis(), expEndMillis);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Timer Fixed Rate Tests
+
+TEST_P(SpinTimerFixedRate, timer_fixedDelay_drifts_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(10, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_EQ(timer.recurringPolicy(), SpinTimer::FIXED_DELAY);
+  EXPECT_CALL(timerAction, timeOverrun).Times(0);
+  EXPECT_CALL(timerAction, timeExpired).Times(1);
+
+  // late by 3 ms, the next interval starts now
+  advanceTMillis(13);
+  scheduleTimers();
+  advanceTMillis(9);
+  scheduleTimers();
+  EXPECT_EQ(timer.getOverrunCount(), 0UL);
+}
+
+TEST_P(SpinTimerFixedRate, timer_fixedRate_keepsPhase_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(10, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  timer.setRecurringPolicy(SpinTimer::FIXED_RATE_SKIP);
+  timer.start();
+  EXPECT_CALL(timerAction, timeOverrun).Times(0);
+  EXPECT_CALL(timerAction, timeExpired).Times(2);
+
+  // late by 3 ms, the next interval still starts at the deadline
+  advanceTMillis(13);
+  scheduleTimers();
+  advanceTMillis(6);
+  scheduleTimers();
+  advanceTMillis(1);
+  scheduleTimers();
+}
+
+TEST_P(SpinTimerFixedRate, timer_fixedRateSkip_overrun_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(10, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  timer.setRecurringPolicy(SpinTimer::FIXED_RATE_SKIP);
+  timer.start();
+  {
+    InSequence seq;
+    EXPECT_CALL(timerAction, timeOverrun(3UL)).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+  }
+
+  // stall: the deadlines 10, 20, 30 and 40 have passed, fires once and continues with 50
+  advanceTMillis(45);
+  scheduleTimers();
+  EXPECT_EQ(timer.getOverrunCount(), 3UL);
+  scheduleTimers();
+  advanceTMillis(4);
+  scheduleTimers();
+  advanceTMillis(1);
+  scheduleTimers();
+  EXPECT_EQ(timer.getOverrunCount(), 0UL);
+}
+
+TEST_P(SpinTimerFixedRate, timer_fixedRateCatchUp_overrun_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(10, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  timer.setRecurringPolicy(SpinTimer::FIXED_RATE_CATCH_UP);
+  timer.start();
+  {
+    InSequence seq;
+    EXPECT_CALL(timerAction, timeOverrun(3UL)).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+    EXPECT_CALL(timerAction, timeOverrun(2UL)).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+    EXPECT_CALL(timerAction, timeOverrun(1UL)).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+    EXPECT_CALL(timerAction, timeExpired).Times(1);
+  }
+
+  // stall: the deadlines 10, 20, 30 and 40 have passed, each of them expires with a subsequent tick
+  advanceTMillis(45);
+  for (unsigned int i = 0; i < 6; i++)
+  {
+    scheduleTimers();
+  }
+  EXPECT_EQ(timer.getOverrunCount(), 0UL);
+
+  // back in phase with deadline 50
+  advanceTMillis(4);
+  scheduleTimers();
+  advanceTMillis(1);
+  scheduleTimers();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Timer Context Tests
+
+TEST(SpinTimer, timer_context_singleTimeRead_test)
+{
+  Mock_UptimeInfo uptimeInfo(100);
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  Mock_SpinTimerAction timerAction;
+  EXPECT_CALL(timerAction, timeExpired)
+      .Times(3);
+
+  SpinTimer timer1(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer3(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  uptimeInfo.setTMillis(110);
+  unsigned long int readsBefore = uptimeInfo.reads();
+  scheduleTimers();
+  EXPECT_EQ(uptimeInfo.reads() - readsBefore, 1UL);
+  EXPECT_FALSE(timer1.isRunning());
+  EXPECT_FALSE(timer2.isRunning());
+  EXPECT_FALSE(timer3.isRunning());
+}
+
+TEST(SpinTimer, timer_context_nextExpiry_test)
+{
+  SpinTimerHeap heap;
+  SpinTimerWheel wheel;
+  SpinTimerEngine* engines[] = { 0, &heap, &wheel };
+
+  for (SpinTimerEngine* engine : engines)
+  {
+    Mock_UptimeInfo uptimeInfo(ULONG_MAX - 50);
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    SpinTimerContext::instance()->setEngine(engine);
+
+    EXPECT_EQ(SpinTimerContext::instance()->nextExpiryMillis(), SpinTimerContext::NO_EXPIRY);
+    {
+      SpinTimer timer1(100, nullptr, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+      SpinTimer timer2(5000, nullptr, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+      // a lower bound is acceptable, but it must never be late
+      unsigned long int nextMillis = SpinTimerContext::instance()->nextExpiryMillis();
+      EXPECT_LE(nextMillis, 100UL);
+      EXPECT_GT(nextMillis, 0UL);
+
+      uptimeInfo.setTMillis(ULONG_MAX + 100 - 50);
+      EXPECT_EQ(SpinTimerContext::instance()->nextExpiryMillis(), 0UL);
+      scheduleTimers();
+      EXPECT_FALSE(timer1.isRunning());
+      nextMillis = SpinTimerContext::instance()->nextExpiryMillis();
+      EXPECT_LE(nextMillis, 4900UL);
+      EXPECT_GT(nextMillis, 0UL);
+    }
+    EXPECT_EQ(SpinTimerContext::instance()->nextExpiryMillis(), SpinTimerContext::NO_EXPIRY);
+    SpinTimerContext::instance()->setEngine(0);
+  }
+}
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+TEST(SpinTimer, timer_delayAndSchedule_sleeps_test)
+{
+  MonotonicUptimeInfoAdapter uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  Mock_SpinTimerAction timerAction;
+  EXPECT_CALL(timerAction, timeExpired)
+      .Times(AtLeast(4));
+  SpinTimer timer(20, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  std::clock_t cpuStart = std::clock();
+  unsigned long int wallStart = uptimeInfo.tMillis();
+  delayAndSchedule(100);
+  std::clock_t cpuMillis = (std::clock() - cpuStart) * 1000 / CLOCKS_PER_SEC;
+
+  EXPECT_GE(uptimeInfo.tMillis() - wallStart, 100UL);
+  EXPECT_LT(cpuMillis, 50);
+  timer.cancel();
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Setup tests for test cases with multiple parameters
 
@@ -197,4 +409,11 @@ INSTANTIATE_TEST_CASE_P(
         SpinTimerRecurringTestParam(10, 0, 100),
         SpinTimerRecurringTestParam(10, ULONG_MAX, 500),
         SpinTimerRecurringTestParam(10, ULONG_MAX-1, 500)
-        ));
\ No newline at end of file
+        ));
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimer,
+    SpinTimerFixedRate,
+    ::testing::Combine(
+        ::testing::Values(0, 1, 2),                                // Engine: none | SpinTimerHeap | SpinTimerWheel
+        ::testing::Values(0UL, ULONG_MAX - 15, ULONG_MAX - 42)));  // StartMillis
\ No newline at end of file
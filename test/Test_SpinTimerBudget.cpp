@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class SpinTimerBudgetTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    uptimeInfo.setTMillis(0);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+class IdRecordingSpinTimerAction : public SpinTimerAction
+{
+public:
+  IdRecordingSpinTimerAction(std::vector<int>& ids, int id) : m_ids(ids), m_id(id), overruns(0) { }
+  void timeExpired() { m_ids.push_back(m_id); }
+  void timeOverrun(unsigned long overrunCount) { overruns += overrunCount; }
+
+private:
+  std::vector<int>& m_ids;
+  int m_id;
+
+public:
+  unsigned long overruns;
+};
+
+class SlowSpinTimerAction : public SpinTimerAction
+{
+public:
+  SlowSpinTimerAction(Mock_UptimeInfo& uptimeInfo) : m_uptimeInfo(uptimeInfo), count(0) { }
+  void timeExpired()
+  {
+    // each notification takes 3 ms
+    m_uptimeInfo.setTMillis(m_uptimeInfo.tMillis() + 3);
+    count++;
+  }
+
+private:
+  Mock_UptimeInfo& m_uptimeInfo;
+
+public:
+  unsigned long count;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Budget Tests
+
+TEST_F(SpinTimerBudgetTest, budget_callbackCount_mostOverdueFirst_test)
+{
+  std::vector<int> ids;
+  IdRecordingSpinTimerAction action1(ids, 1);
+  IdRecordingSpinTimerAction action2(ids, 2);
+  IdRecordingSpinTimerAction action3(ids, 3);
+  IdRecordingSpinTimerAction action4(ids, 4);
+  IdRecordingSpinTimerAction action5(ids, 5);
+  SpinTimer timer1(40, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(10, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer3(30, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer4(20, &action4, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer5(50, &action5, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  uptimeInfo.setTMillis(45);
+  EXPECT_FALSE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 2));
+  EXPECT_EQ(std::vector<int>({ 2, 4 }), ids);
+  EXPECT_EQ(2UL, SpinTimerContext::instance()->pendingCount());
+  EXPECT_EQ(0U, SpinTimerContext::instance()->nextExpiryTicks());
+
+  // the leftovers come ahead of the newly expired timer
+  uptimeInfo.setTMillis(55);
+  EXPECT_FALSE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 2));
+  EXPECT_EQ(std::vector<int>({ 2, 4, 3, 1 }), ids);
+  EXPECT_TRUE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 2));
+  EXPECT_EQ(std::vector<int>({ 2, 4, 3, 1, 5 }), ids);
+  EXPECT_EQ(0UL, SpinTimerContext::instance()->pendingCount());
+}
+
+TEST_F(SpinTimerBudgetTest, budget_time_test)
+{
+  SlowSpinTimerAction action(uptimeInfo);
+  std::vector<SpinTimer*> timers;
+  for (int i = 0; i < 100; i++)
+  {
+    timers.push_back(new SpinTimer(10, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART));
+  }
+
+  // 10 ms budget: 4 notifications of 3 ms per call (the budget is checked before each notification)
+  uptimeInfo.setTMillis(10);
+  unsigned long calls = 0;
+  while (!SpinTimerContext::instance()->handleTick(10 * SPINTIMER_TICKS_PER_MILLI))
+  {
+    calls++;
+    EXPECT_EQ(4 * calls, action.count);
+  }
+  EXPECT_EQ(100UL, action.count);
+  EXPECT_EQ(24UL, calls);
+
+  for (unsigned int i = 0; i < timers.size(); i++)
+  {
+    delete timers[i];
+  }
+}
+
+TEST_F(SpinTimerBudgetTest, budget_progress_test)
+{
+  std::vector<int> ids;
+  IdRecordingSpinTimerAction action1(ids, 1);
+  IdRecordingSpinTimerAction action2(ids, 2);
+  SpinTimer timer1(10, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(10, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  uptimeInfo.setTMillis(10);
+
+  // even a zero budget runs one notification
+  EXPECT_FALSE(SpinTimerContext::instance()->handleTick(0, 0));
+  EXPECT_EQ(std::vector<int>({ 1 }), ids);
+  EXPECT_TRUE(SpinTimerContext::instance()->handleTick(0, 0));
+  EXPECT_EQ(std::vector<int>({ 1, 2 }), ids);
+}
+
+TEST_F(SpinTimerBudgetTest, budget_cancelAndDestroyDropPending_test)
+{
+  std::vector<int> ids;
+  IdRecordingSpinTimerAction action1(ids, 1);
+  IdRecordingSpinTimerAction action2(ids, 2);
+  IdRecordingSpinTimerAction action3(ids, 3);
+  SpinTimer timer1(10, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(11, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer* timer3 = new SpinTimer(12, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  uptimeInfo.setTMillis(20);
+
+  EXPECT_FALSE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 1));
+  EXPECT_EQ(2UL, SpinTimerContext::instance()->pendingCount());
+  timer2.cancel();
+  delete timer3;
+  EXPECT_EQ(0UL, SpinTimerContext::instance()->pendingCount());
+  EXPECT_TRUE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 1));
+  EXPECT_EQ(std::vector<int>({ 1 }), ids);
+}
+
+TEST_F(SpinTimerBudgetTest, budget_recurringOverrun_test)
+{
+  std::vector<int> ids;
+  IdRecordingSpinTimerAction action1(ids, 1);
+  IdRecordingSpinTimerAction action2(ids, 2);
+  SpinTimer timer1(5, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(10, &action2, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  uptimeInfo.setTMillis(10);
+  EXPECT_FALSE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 1));
+
+  // timer 2 expires again while its notification is pending
+  uptimeInfo.setTMillis(20);
+  EXPECT_TRUE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 1));
+  EXPECT_EQ(std::vector<int>({ 1, 2 }), ids);
+  EXPECT_EQ(1UL, action2.overruns);
+}
+
+TEST_F(SpinTimerBudgetTest, budget_engine_plainTickRunsPending_test)
+{
+  SpinTimerHeap heap;
+  SpinTimerContext::instance()->setEngine(&heap);
+  {
+    std::vector<int> ids;
+    IdRecordingSpinTimerAction action1(ids, 1);
+    IdRecordingSpinTimerAction action2(ids, 2);
+    IdRecordingSpinTimerAction action3(ids, 3);
+    SpinTimer timer1(30, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+    SpinTimer timer2(20, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+    SpinTimer timer3(10, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+    uptimeInfo.setTMillis(30);
+    EXPECT_FALSE(SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 1));
+    EXPECT_EQ(std::vector<int>({ 3 }), ids);
+
+    // without budget, all pending notifications are run
+    SpinTimerContext::instance()->handleTick();
+    EXPECT_EQ(std::vector<int>({ 3, 2, 1 }), ids);
+  }
+  SpinTimerContext::instance()->setEngine(0);
+}
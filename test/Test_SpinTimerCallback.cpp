@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "SpinTimer.h"
+#include "SpinTimerCallback.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerWorkerPool.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+
+static unsigned int s_functionCount = 0;
+
+static void countingFunction()
+{
+  s_functionCount++;
+}
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+/**
+ * Callable object taking its time, records whether it has been destroyed while being called.
+ */
+struct SlowCallable
+{
+  SlowCallable(std::atomic<unsigned int>* calls, std::atomic<unsigned int>* violations)
+  : isAlive(true), calls(calls), violations(violations) { }
+  SlowCallable(const SlowCallable& src)
+  : isAlive(true), calls(src.calls), violations(src.violations) { }
+  ~SlowCallable() { isAlive = false; }
+  void operator () ()
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    if (!isAlive)
+    {
+      (*violations)++;
+    }
+    (*calls)++;
+  }
+  std::atomic<bool> isAlive;
+  std::atomic<unsigned int>* calls;
+  std::atomic<unsigned int>* violations;
+};
+#endif
+
+class SpinTimerCallbackTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  void run(unsigned long int millis)
+  {
+    for (unsigned long int i = 0; i < millis; i++)
+    {
+      uptimeInfo.incrementTMillis();
+      scheduleTimers();
+    }
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Callback Tests
+
+TEST_F(SpinTimerCallbackTest, timer_callback_lambda_test)
+{
+  unsigned int count = 0;
+  SpinTimerCallback timer(10, [&count]() { count++; }, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_TRUE(timer.isRunning());
+  EXPECT_EQ(timer.action(), nullptr);
+
+  run(100);
+  EXPECT_EQ(count, 10U);
+
+  // isExpired() polling keeps working
+  run(9);
+  uptimeInfo.incrementTMillis();
+  EXPECT_TRUE(timer.isExpired());
+  EXPECT_EQ(count, 11U);
+}
+
+TEST_F(SpinTimerCallbackTest, timer_callback_function_test)
+{
+  s_functionCount = 0;
+  SpinTimerCallback<void (*)()> timer1(5, countingFunction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimerCallback timer2(10, countingFunction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  EXPECT_FALSE(timer2.isRunning());
+  timer2.start();
+
+  run(20);
+  EXPECT_EQ(s_functionCount, 2U);
+  EXPECT_FALSE(timer1.isRunning());
+  EXPECT_FALSE(timer2.isRunning());
+}
+
+TEST_F(SpinTimerCallbackTest, timer_callback_statefulFunctor_test)
+{
+  struct Counter
+  {
+    unsigned int count;
+    void operator()() { count++; }
+  };
+
+  SpinTimerHeap heap;
+  SpinTimerContext context;
+  context.setEngine(&heap);
+  context.makeCurrent();
+
+  SpinTimerCallback<Counter> timer(10, Counter{0}, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_EQ(timer.context(), &context);
+  run(35);
+  EXPECT_EQ(timer.callback().count, 3U);
+
+  SpinTimerContext::instance()->makeCurrent();
+}
+
+TEST_F(SpinTimerCallbackTest, timer_callback_actionStillSupported_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+  run(10);
+}
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+TEST_F(SpinTimerCallbackTest, timer_callback_dispatched_test)
+{
+  SpinTimerWorkerPool pool(2);
+  SpinTimerContext context;
+  context.setDispatcher(&pool);
+
+  std::atomic<unsigned int> count(0);
+  {
+    SpinTimerCallback timer(1, [&count]() { count++; }, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART, &context);
+    for (unsigned int i = 0; i < 50; i++)
+    {
+      uptimeInfo.incrementTMillis();
+      context.handleTick();
+    }
+  }
+  EXPECT_EQ(count, 50U);
+}
+
+TEST_F(SpinTimerCallbackTest, timer_callback_destroyedWhileDispatched_test)
+{
+  SpinTimerWorkerPool pool(1);
+  SpinTimerContext context;
+  context.setDispatcher(&pool);
+
+  std::atomic<unsigned int> calls(0);
+  std::atomic<unsigned int> violations(0);
+  {
+    SpinTimerCallback<SlowCallable> timer(1, SlowCallable(&calls, &violations), SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART, &context);
+    uptimeInfo.incrementTMillis();
+    context.handleTick();
+  }
+
+  // the callable object has been destroyed after its call has returned
+  EXPECT_EQ(calls, 1U);
+  EXPECT_EQ(violations, 0U);
+}
+#endif
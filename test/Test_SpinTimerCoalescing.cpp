@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class SpinTimerCoalescingTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    uptimeInfo.setTMillis(0);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+class SlackRecordingSpinTimerAction : public SpinTimerAction
+{
+public:
+  void timeExpired() { stamps.push_back(UptimeInfo::Instance()->tMillis()); }
+  std::vector<unsigned long> stamps;
+};
+
+/**
+ * Run the sleeping loop, jumping to the next expiration as scheduleTimersAndSleep() would.
+ * @return Number of wakeups.
+ */
+static unsigned long sleepingLoop(Mock_UptimeInfo& uptimeInfo, unsigned long endMillis)
+{
+  unsigned long wakeUps = 0;
+  while (uptimeInfo.tMillis() < endMillis)
+  {
+    scheduleTimers();
+    SpinTimerTick sleepTicks = SpinTimerContext::instance()->nextExpiryTicks();
+    if (SpinTimerContext::NO_EXPIRY_TICKS == sleepTicks)
+    {
+      break;
+    }
+    uptimeInfo.setTMillis(uptimeInfo.tMillis() + ((0 != sleepTicks) ? static_cast<unsigned long>(sleepTicks / SPINTIMER_TICKS_PER_MILLI) : 1));
+    wakeUps++;
+  }
+  return wakeUps;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Coalescing Tests
+
+TEST(SpinTimerCoalescing, coalesce_grid_test)
+{
+  EXPECT_EQ(1000U, SpinTimerContext::coalesce(1000, 0));
+  EXPECT_EQ(1001U, SpinTimerContext::coalesce(1001, 1));
+  EXPECT_EQ(1024U, SpinTimerContext::coalesce(1001, 50));   // grid 32
+  EXPECT_EQ(1024U, SpinTimerContext::coalesce(1024, 50));
+  EXPECT_EQ(1008U, SpinTimerContext::coalesce(1001, 15));   // grid 8
+  EXPECT_EQ(1024U, SpinTimerContext::coalesce(1001, 64));   // grid 64
+}
+
+TEST_F(SpinTimerCoalescingTest, timer_slack_batch_test)
+{
+  SlackRecordingSpinTimerAction action1;
+  SlackRecordingSpinTimerAction action2;
+  SlackRecordingSpinTimerAction action3;
+  SpinTimer timer1(100, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART, 0, 40);
+  SpinTimer timer2(110, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART, 0, 40);
+  SpinTimer timer3(120, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART, 0, 40);
+  EXPECT_EQ(40UL, timer1.getSlack());
+  timer1.start();
+  timer2.start();
+  timer3.start();
+
+  // slack 40 ms: grid 32 ms, all three deadlines coalesce to 128 ms
+  for (unsigned long i = 0; i < 200; i++)
+  {
+    uptimeInfo.incrementTMillis();
+    scheduleTimers();
+  }
+  ASSERT_EQ(1U, action1.stamps.size());
+  ASSERT_EQ(1U, action2.stamps.size());
+  ASSERT_EQ(1U, action3.stamps.size());
+  EXPECT_EQ(128UL, action1.stamps[0]);
+  EXPECT_EQ(128UL, action2.stamps[0]);
+  EXPECT_EQ(128UL, action3.stamps[0]);
+}
+
+TEST_F(SpinTimerCoalescingTest, timer_slack_neverEarly_test)
+{
+  SlackRecordingSpinTimerAction action;
+  SpinTimer timer(0, &action);
+  for (unsigned long startMillis = 0; startMillis < 70; startMillis += 7)
+  {
+    uptimeInfo.setTMillis(startMillis);
+    timer.start(100, 20);
+    while (timer.isRunning())
+    {
+      uptimeInfo.incrementTMillis();
+      scheduleTimers();
+    }
+    unsigned long firedMillis = action.stamps.back();
+    EXPECT_GE(firedMillis, startMillis + 100);
+    EXPECT_LT(firedMillis, startMillis + 100 + 20);
+  }
+}
+
+TEST_F(SpinTimerCoalescingTest, timer_slack_fewerWakeUps_test)
+{
+  SpinTimerHeap heap;
+  SpinTimerContext::instance()->setEngine(&heap);
+  SlackRecordingSpinTimerAction action;
+
+  // intervals 97, 101, 103, 107 ms
+  SpinTimer timer1(97, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(101, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer3(103, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer4(107, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  unsigned long exactWakeUps = sleepingLoop(uptimeInfo, 10000);
+  unsigned long exactFired = action.stamps.size();
+
+  uptimeInfo.setTMillis(0);
+  action.stamps.clear();
+  timer1.start(97, 64);
+  timer2.start(101, 64);
+  timer3.start(103, 64);
+  timer4.start(107, 64);
+  unsigned long coalescedWakeUps = sleepingLoop(uptimeInfo, 10000);
+
+  EXPECT_LT(coalescedWakeUps * 2, exactWakeUps);
+  EXPECT_GT(action.stamps.size() * 3, exactFired * 2);
+  SpinTimerContext::instance()->setEngine(0);
+}
+
+TEST_F(SpinTimerCoalescingTest, timer_slack_fixedRate_noDrift_test)
+{
+  SlackRecordingSpinTimerAction action;
+  SpinTimer timer(100, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART, 0, 10);
+  timer.setRecurringPolicy(SpinTimer::FIXED_RATE_CATCH_UP);
+  uptimeInfo.setTMillis(3);
+  timer.start();
+  for (unsigned long i = 0; i < 1010; i++)
+  {
+    uptimeInfo.incrementTMillis();
+    scheduleTimers();
+  }
+
+  // exact deadlines 103, 203, .. coalesced to the 8 ms grid: 104, 208, 304, ..
+  ASSERT_EQ(10U, action.stamps.size());
+  for (unsigned int i = 0; i < action.stamps.size(); i++)
+  {
+    unsigned long exactMillis = 3 + (i + 1) * 100;
+    EXPECT_GE(action.stamps[i], exactMillis);
+    EXPECT_LT(action.stamps[i], exactMillis + 8);
+    EXPECT_EQ(0UL, action.stamps[i] % 8);
+  }
+}
+
+TEST_F(SpinTimerCoalescingTest, timer_slack_wrap_test)
+{
+  SlackRecordingSpinTimerAction action;
+  uptimeInfo.setTMillis(ULONG_MAX - 20);
+  SpinTimer timer(10, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART, 0, 16);
+  timer.start();
+  for (unsigned long i = 0; i < 72; i++)
+  {
+    uptimeInfo.incrementTMillis();
+    scheduleTimers();
+  }
+
+  // deadlines coalesced to the 16 ms grid, consistent across the wrap: ULONG_MAX - 10 coalesced to 0, then 16, 32, 48
+  std::vector<unsigned long> expected = { 0UL, 16UL, 32UL, 48UL };
+  EXPECT_EQ(expected, action.stamps);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <chrono>
+#include <thread>
+
+#include "SpinTimer.h"
+#include "SpinTimerCompact.h"
+#include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+// First: delayMillis Second: startMillis
+typedef std::tuple<unsigned long int, unsigned long int> SpinTimerCompactTestParam;
+
+class SpinTimerCompactTest : public ::testing::TestWithParam<SpinTimerCompactTestParam>
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compact Timer Tests
+
+TEST(SpinTimerCompact, compact_footprint_test)
+{
+  EXPECT_LE(sizeof(SpinTimerCompact), 3 * sizeof(SpinTimerTick));
+  EXPECT_LE(2 * sizeof(SpinTimerCompact), sizeof(SpinTimer));
+}
+
+TEST_P(SpinTimerCompactTest, compact_singleShot_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+  unsigned long int expEndMillis = startMillis + delayMillis;
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerCompact timer(delayMillis, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_TRUE(timer.isRunning());
+
+  while (uptimeInfo.tMillis() != expEndMillis)
+  {
+    EXPECT_FALSE(timer.isExpired());
+    uptimeInfo.incrementTMillis();
+  }
+  EXPECT_TRUE(timer.isExpired());
+  EXPECT_FALSE(timer.isRunning());
+  uptimeInfo.incrementTMillis();
+  EXPECT_FALSE(timer.isExpired());
+}
+
+TEST_P(SpinTimerCompactTest, compact_sameAsSpinTimer_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimer timer(delayMillis, 0, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimerCompact compact(delayMillis, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  for (unsigned long int i = 0; i < 5 * delayMillis + 20; i++)
+  {
+    uptimeInfo.incrementTMillis();
+    EXPECT_EQ(timer.isExpired(), compact.isExpired()) << "at " << uptimeInfo.tMillis();
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SpinTimerCompactTest_Wrap, SpinTimerCompactTest,
+    ::testing::Values(
+        std::make_tuple(10, 0UL),
+        std::make_tuple(10, ULONG_MAX),
+        std::make_tuple(10, ULONG_MAX - 1),
+        std::make_tuple(10, ULONG_MAX - 10),
+        std::make_tuple(10, ULONG_MAX - 10 + 1),
+        std::make_tuple(0, ULONG_MAX),
+        std::make_tuple(0, ULONG_MAX - 1)));
+
+TEST(SpinTimerCompact, compact_cancel_test)
+{
+  Mock_UptimeInfo uptimeInfo(100);
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  SpinTimerCompact timer(10, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  uptimeInfo.setTMillis(110);
+  EXPECT_TRUE(timer.isExpired());
+  EXPECT_TRUE(timer.isRunning());
+  EXPECT_EQ(10U, timer.remainingTicks(110 * SPINTIMER_TICKS_PER_MILLI) / SPINTIMER_TICKS_PER_MILLI);
+
+  timer.cancel();
+  uptimeInfo.setTMillis(200);
+  EXPECT_FALSE(timer.isExpired());
+  EXPECT_FALSE(timer.isRunning());
+
+  timer.start(5);
+  uptimeInfo.setTMillis(205);
+  EXPECT_TRUE(timer.isExpired());
+  EXPECT_EQ(5UL, timer.getInterval());
+}
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+TEST(SpinTimerCompact, compact_defaultUptime_test)
+{
+  // no mock: run alone, the default adapter gets installed by the timer's first up-time reading; run after other tests,
+  // their mocks are gone already, a live clock has to be reinstalled then
+  static MonotonicUptimeInfoAdapter s_uptimeInfo;
+  if (0 != UptimeInfo::adapter())
+  {
+    UptimeInfo::Instance()->setAdapter(&s_uptimeInfo);
+  }
+
+  SpinTimerCompact timer(5, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_TRUE(timer.isExpired());
+  EXPECT_FALSE(timer.isRunning());
+}
+#endif
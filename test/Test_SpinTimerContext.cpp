@@ -0,0 +1,273 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+#include "CountingSpinTimerAction.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class AtomicUptimeInfo : public UptimeInfoAdapter
+{
+public:
+  AtomicUptimeInfo() : m_Millis(0) { }
+
+  void incrementTMillis() { m_Millis++; }
+
+  // UptimeInfo interface
+  unsigned long tMillis() { return m_Millis; }
+
+private:
+  std::atomic<unsigned long> m_Millis;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Context Tests
+
+TEST(SpinTimerContext, timer_context_independentContexts_test)
+{
+  Mock_UptimeInfo uptimeInfo(0);
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  SpinTimerContext contextA;
+  SpinTimerContext contextB;
+  SpinTimerHeap heap;
+  contextB.setEngine(&heap);
+
+  Mock_SpinTimerAction actionA;
+  Mock_SpinTimerAction actionB;
+  SpinTimer timerA(10, &actionA, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART, &contextA);
+  SpinTimer timerB(10, &actionB, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART, &contextB);
+  EXPECT_EQ(timerA.context(), &contextA);
+  EXPECT_EQ(timerB.context(), &contextB);
+  EXPECT_CALL(actionA, timeExpired).Times(Exactly(1));
+  EXPECT_CALL(actionB, timeExpired).Times(Exactly(1));
+
+  // kicking the default context does not affect the timers of the other contexts
+  uptimeInfo.setTMillis(10);
+  scheduleTimers();
+  EXPECT_TRUE(timerA.isRunning());
+  EXPECT_TRUE(timerB.isRunning());
+
+  contextA.handleTick();
+  EXPECT_FALSE(timerA.isRunning());
+  EXPECT_TRUE(timerB.isRunning());
+  EXPECT_EQ(contextA.nextExpiryMillis(), SpinTimerContext::NO_EXPIRY);
+  EXPECT_EQ(contextB.nextExpiryMillis(), 0UL);
+
+  contextB.handleTick();
+  EXPECT_FALSE(timerB.isRunning());
+}
+
+TEST(SpinTimerContext, timer_context_makeCurrent_test)
+{
+  Mock_UptimeInfo uptimeInfo(0);
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  EXPECT_EQ(SpinTimerContext::current(), SpinTimerContext::instance());
+
+  SpinTimerContext context;
+  context.makeCurrent();
+  EXPECT_EQ(SpinTimerContext::current(), &context);
+  {
+    Mock_SpinTimerAction timerAction;
+    SpinTimer timer(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+    EXPECT_EQ(timer.context(), &context);
+    EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+    uptimeInfo.setTMillis(10);
+    scheduleTimers();
+    EXPECT_FALSE(timer.isRunning());
+  }
+  SpinTimerContext::instance()->makeCurrent();
+  EXPECT_EQ(SpinTimerContext::current(), SpinTimerContext::instance());
+}
+
+TEST(SpinTimerContext, timer_context_threadInstance_test)
+{
+  const unsigned int numOfThreads = 4;
+  const unsigned long numOfExpirations = 20;
+
+  AtomicUptimeInfo uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  std::atomic<unsigned int> done(0);
+  std::vector<SpinTimerContext*> contexts(numOfThreads);
+  std::vector<unsigned long> counts(numOfThreads);
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < numOfThreads; i++)
+  {
+    threads.push_back(std::thread([&, i]()
+    {
+      contexts[i] = SpinTimerContext::threadInstance();
+      CountingSpinTimerAction timerAction;
+      SpinTimer timer(1, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+      EXPECT_EQ(timer.context(), contexts[i]);
+      while (timerAction.count() < numOfExpirations)
+      {
+        scheduleTimers();
+        std::this_thread::yield();
+      }
+      counts[i] = timerAction.count();
+      done++;
+    }));
+  }
+
+  // drive the common up-time until all the threads are done
+  while (done < numOfThreads)
+  {
+    uptimeInfo.incrementTMillis();
+    std::this_thread::yield();
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (unsigned int i = 0; i < numOfThreads; i++)
+  {
+    EXPECT_EQ(counts[i], numOfExpirations);
+    EXPECT_NE(contexts[i], SpinTimerContext::instance());
+    for (unsigned int j = 0; j < i; j++)
+    {
+      EXPECT_NE(contexts[i], contexts[j]);
+    }
+  }
+  EXPECT_EQ(SpinTimerContext::current(), SpinTimerContext::instance());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Cross Thread Control Tests
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+
+TEST(SpinTimerContext, timer_context_postedCommands_test)
+{
+  Mock_UptimeInfo uptimeInfo(0);
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  SpinTimerContext context;
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART, &context);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+  // applied with the next handleTick() only
+  timer.postStart(20);
+  EXPECT_FALSE(timer.isRunning());
+  context.handleTick();
+  EXPECT_TRUE(timer.isRunning());
+  EXPECT_EQ(timer.getInterval(), 20UL);
+
+  // the latest command wins
+  timer.postCancel();
+  timer.postStart();
+  context.handleTick();
+  EXPECT_TRUE(timer.isRunning());
+  timer.postStart(5);
+  timer.postCancel();
+  context.handleTick();
+  EXPECT_FALSE(timer.isRunning());
+
+  timer.postStart(5);
+  context.handleTick();
+  uptimeInfo.setTMillis(5);
+  context.handleTick();
+  EXPECT_TRUE(timer.fetchExpired());
+  EXPECT_FALSE(timer.fetchExpired());
+}
+
+TEST(SpinTimerContext, timer_context_postFromThreads_test)
+{
+  const unsigned int numOfTimers = 16;
+  const unsigned int numOfProducers = 4;
+  const unsigned int numOfCommands = 20000;
+
+  AtomicUptimeInfo uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  SpinTimerContext context;
+  std::vector<SpinTimer*> timers;
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    timers.push_back(new SpinTimer(1, 0, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART, &context));
+  }
+
+  std::atomic<unsigned int> done(0);
+  std::atomic<unsigned long> expirations(0);
+  std::vector<std::thread> producers;
+  for (unsigned int p = 0; p < numOfProducers; p++)
+  {
+    producers.push_back(std::thread([&, p]()
+    {
+      for (unsigned int i = 0; i < numOfCommands; i++)
+      {
+        SpinTimer* timer = timers[(i + p) % numOfTimers];
+        switch (i % 3)
+        {
+          case 0:  timer->postStart(1 + i % 5); break;
+          case 1:  timer->postStart();          break;
+          default: timer->postCancel();         break;
+        }
+        if (timer->fetchExpired())
+        {
+          expirations++;
+        }
+      }
+      done++;
+    }));
+  }
+
+  // owner thread
+  while (done < numOfProducers)
+  {
+    uptimeInfo.incrementTMillis();
+    context.handleTick();
+  }
+  for (std::thread& producer : producers)
+  {
+    producer.join();
+  }
+
+  for (SpinTimer* timer : timers)
+  {
+    timer->postCancel();
+  }
+  context.handleTick();
+  for (SpinTimer* timer : timers)
+  {
+    EXPECT_FALSE(timer->isRunning());
+    delete timer;
+  }
+  EXPECT_EQ(context.nextExpiryMillis(), SpinTimerContext::NO_EXPIRY);
+}
+
+TEST(SpinTimerContext, timer_context_postIntervalFromThreads_test)
+{
+  AtomicUptimeInfo uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  SpinTimerContext context;
+  SpinTimer timer(10, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART, &context);
+
+  // the interval posted with the start command is never the one of another command
+  std::atomic<bool> isStopped(false);
+  std::thread starter([&]() { while (!isStopped) { timer.postStart(10); } });
+  std::thread canceller([&]() { while (!isStopped) { timer.postCancel(); } });
+  for (unsigned int i = 0; i < 20000; i++)
+  {
+    context.handleTick();
+    EXPECT_EQ(timer.getInterval(), 10UL);
+  }
+  isStopped = true;
+  starter.join();
+  canceller.join();
+}
+#endif
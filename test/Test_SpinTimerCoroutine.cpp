@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerCoroutine.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerSleepQueue.h"
+#include "SpinTimerWorkerPool.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class SpinTimerCoroutineTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    uptimeInfo.setTMillis(0);
+  }
+
+  void runUntil(unsigned long endMillis)
+  {
+    while (uptimeInfo.tMillis() < endMillis)
+    {
+      uptimeInfo.incrementTMillis();
+      scheduleTimers();
+    }
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+struct StampLog
+{
+  std::vector<std::string> entries;
+
+  void log(const char* what)
+  {
+    entries.push_back(std::to_string(UptimeInfo::Instance()->tMillis()) + ":" + what);
+  }
+};
+
+SpinTimerTask doubleStrobe(StampLog& log, int cycles)
+{
+  for (int cycle = 0; cycle < cycles; cycle++)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      log.log("toggle");
+      co_await spinDelay(200);
+    }
+    log.log("pause");
+    co_await spinDelay(1000);
+  }
+  log.log("done");
+}
+
+SpinTimerTask sleeper(unsigned long delayMillis, unsigned long& wakeUps, unsigned long count)
+{
+  while (wakeUps < count)
+  {
+    co_await spinDelay(delayMillis);
+    wakeUps++;
+  }
+}
+
+SpinTimerTask once(unsigned long delayMillis, StampLog& log, const char* what)
+{
+  co_await spinDelay(delayMillis);
+  log.log(what);
+}
+
+SpinTimerTask forever(unsigned long delayMillis)
+{
+  for (;;)
+  {
+    co_await spinDelay(delayMillis);
+  }
+}
+
+SpinTimerTask waiter(SpinTimerAwaitable& timer, StampLog& log, const char* what, int count)
+{
+  for (int i = 0; i < count; i++)
+  {
+    co_await timer.expired();
+    log.log(what);
+  }
+}
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+SpinTimerTask threadRecorder(SpinTimerAwaitable& timer, std::vector<std::thread::id>& threads, int count)
+{
+  for (int i = 0; i < count; i++)
+  {
+    co_await spinDelay(10);
+    threads.push_back(std::this_thread::get_id());
+    co_await timer.expired();
+    threads.push_back(std::this_thread::get_id());
+  }
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Coroutine Tests
+
+TEST_F(SpinTimerCoroutineTest, coroutine_delay_sequence_test)
+{
+  StampLog log;
+  doubleStrobe(log, 2);
+  runUntil(5000);
+
+  std::vector<std::string> expected = {
+    "0:toggle", "200:toggle", "400:toggle", "600:pause",
+    "1600:toggle", "1800:toggle", "2000:toggle", "2200:pause",
+    "3200:done" };
+  EXPECT_EQ(expected, log.entries);
+  EXPECT_EQ(0UL, SpinTimerContext::current()->sleepQueue()->size());
+  EXPECT_EQ(0UL, SpinTimerFramePool::inUse());
+}
+
+TEST_F(SpinTimerCoroutineTest, coroutine_delay_order_test)
+{
+  StampLog log;
+  once(30, log, "a");
+  once(10, log, "b");
+  once(30, log, "c");
+  once(20, log, "d");
+  EXPECT_EQ(4UL, SpinTimerContext::current()->sleepQueue()->size());
+  runUntil(100);
+
+  std::vector<std::string> expected = { "10:b", "20:d", "30:a", "30:c" };
+  EXPECT_EQ(expected, log.entries);
+}
+
+TEST_F(SpinTimerCoroutineTest, coroutine_zeroDelay_test)
+{
+  unsigned long wakeUps = 0;
+  sleeper(0, wakeUps, 5);
+
+  // a zero delay resumes the coroutine once per handleTick() call
+  for (int i = 0; i < 3; i++)
+  {
+    scheduleTimers();
+  }
+  EXPECT_EQ(3UL, wakeUps);
+  for (int i = 0; i < 3; i++)
+  {
+    scheduleTimers();
+  }
+  EXPECT_EQ(5UL, wakeUps);
+  EXPECT_EQ(0UL, SpinTimerContext::current()->sleepQueue()->size());
+}
+
+TEST_F(SpinTimerCoroutineTest, coroutine_manySequences_test)
+{
+  SpinTimerHeap heap;
+  SpinTimerContext::instance()->setEngine(&heap);
+
+  const unsigned long sequences = 5000;
+  StampLog log;
+  unsigned long framesBefore = SpinTimerFramePool::inUse();
+  for (unsigned long i = 0; i < sequences; i++)
+  {
+    once(1 + (i % 50), log, "x");
+  }
+  EXPECT_EQ(framesBefore + sequences, SpinTimerFramePool::inUse());
+  EXPECT_EQ(sequences, SpinTimerContext::instance()->sleepQueue()->size());
+
+  runUntil(60);
+  EXPECT_EQ(framesBefore, SpinTimerFramePool::inUse());
+  EXPECT_EQ(0UL, SpinTimerContext::instance()->sleepQueue()->size());
+  EXPECT_EQ(sequences, log.entries.size());
+
+  SpinTimerContext::instance()->setEngine(0);
+}
+
+TEST_F(SpinTimerCoroutineTest, coroutine_timerExpired_test)
+{
+  StampLog log;
+  SpinTimerAwaitable timer(100, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  waiter(timer, log, "first", 2);
+  waiter(timer, log, "second", 3);
+  runUntil(450);
+
+  std::vector<std::string> expected = {
+    "100:first", "100:second", "200:first", "200:second", "300:second" };
+  EXPECT_EQ(expected, log.entries);
+}
+
+TEST_F(SpinTimerCoroutineTest, coroutine_sleepQueue_cancel_test)
+{
+  SpinTimerSleepQueue* queue = SpinTimerContext::instance()->sleepQueue();
+  unsigned long wakeUps = 0;
+  SpinTimerSleeper sleeper1([](void* arg) { (*static_cast<unsigned long*>(arg))++; }, &wakeUps);
+  SpinTimerSleeper sleeper2([](void* arg) { (*static_cast<unsigned long*>(arg)) += 10; }, &wakeUps);
+  queue->sleep(&sleeper1, 10 * SPINTIMER_TICKS_PER_MILLI);
+  queue->sleep(&sleeper2, 5 * SPINTIMER_TICKS_PER_MILLI);
+  queue->cancel(&sleeper2);
+  EXPECT_EQ(1UL, queue->size());
+
+  runUntil(20);
+  EXPECT_EQ(1UL, wakeUps);
+  EXPECT_EQ(0UL, queue->size());
+}
+
+TEST_F(SpinTimerCoroutineTest, coroutine_exitWhileSuspended_test)
+{
+  // the thread's frame pool gets destroyed before the static context, whose sleep queue still keeps the sleeper;
+  // the death test process runs this test only, not the state left over by the other tests (i.e. threads)
+  GTEST_FLAG_SET(death_test_style, "threadsafe");
+  EXPECT_EXIT(
+  {
+    forever(100);
+    runUntil(250);
+    exit(0);
+  }, ::testing::ExitedWithCode(0), "");
+}
+
+#ifdef SPINTIMER_CROSS_THREAD_CONTROL
+TEST_F(SpinTimerCoroutineTest, coroutine_dispatcherBypassed_test)
+{
+  // the coroutines get resumed by the thread kicking the context, not by the dispatcher's worker threads
+  SpinTimerWorkerPool pool(2);
+  SpinTimerContext::instance()->setDispatcher(&pool);
+  std::vector<std::thread::id> threads;
+  {
+    SpinTimerAwaitable timer(100, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+    threadRecorder(timer, threads, 3);
+    runUntil(400);
+  }
+  SpinTimerContext::instance()->setDispatcher(0);
+
+  ASSERT_EQ(6U, threads.size());
+  for (unsigned int i = 0; i < threads.size(); i++)
+  {
+    EXPECT_EQ(std::this_thread::get_id(), threads[i]);
+  }
+}
+#endif
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include "SpinTimerFd.h"
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include <poll.h>
+
+#include "SpinTimer.h"
+#include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Timer File Descriptor Tests
+
+TEST(SpinTimerFd, timerFd_disarmed_test)
+{
+  MonotonicUptimeInfoAdapter uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  SpinTimerFd timerFd;
+  ASSERT_GE(timerFd.fd(), 0);
+
+  struct pollfd pfd = { timerFd.fd(), POLLIN, 0 };
+  EXPECT_EQ(poll(&pfd, 1, 20), 0);
+}
+
+TEST(SpinTimerFd, timerFd_wakeup_test)
+{
+  MonotonicUptimeInfoAdapter uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+  Mock_SpinTimerAction timerAction;
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(2));
+  SpinTimer timer(30, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer laterTimer(60, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  SpinTimerFd timerFd;
+  ASSERT_GE(timerFd.fd(), 0);
+
+  unsigned long int startMillis = uptimeInfo.tMillis();
+  struct pollfd pfd = { timerFd.fd(), POLLIN, 0 };
+  while (timer.isRunning())
+  {
+    ASSERT_EQ(poll(&pfd, 1, 1000), 1);
+    timerFd.handleEvent();
+  }
+  EXPECT_GE(uptimeInfo.tMillis() - startMillis, 30UL);
+  EXPECT_TRUE(laterTimer.isRunning());
+
+  while (laterTimer.isRunning())
+  {
+    ASSERT_EQ(poll(&pfd, 1, 1000), 1);
+    timerFd.handleEvent();
+  }
+  EXPECT_GE(uptimeInfo.tMillis() - startMillis, 60UL);
+
+  // no timer running anymore
+  EXPECT_EQ(poll(&pfd, 1, 20), 0);
+}
+
+#endif
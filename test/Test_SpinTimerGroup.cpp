@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <tuple>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerGroup.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerWheel.h"
+#include "SpinTimerScan.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class GroupCountingSpinTimerAction : public SpinTimerAction
+{
+public:
+  GroupCountingSpinTimerAction() : count(0), lastMillis(0) { }
+  void timeExpired() { count++; lastMillis = UptimeInfo::Instance()->tMillis(); }
+  unsigned long count;
+  unsigned long lastMillis;
+};
+
+// First: engine (0: none, 1: SpinTimerHeap, 2: SpinTimerWheel, 3: SpinTimerScan) Second: startMillis
+typedef std::tuple<int, unsigned long int> SpinTimerGroupTestParam;
+
+class SpinTimerGroupTest : public ::testing::TestWithParam<SpinTimerGroupTestParam>
+{
+protected:
+  void SetUp()
+  {
+    uptimeInfo.setTMillis(std::get<1>(GetParam()));
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    SpinTimerEngine* engines[] = { 0, &heap, &wheel, &scan };
+    SpinTimerContext::instance()->setEngine(engines[std::get<0>(GetParam())]);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  /**
+   * Advance the up-time millisecond by millisecond, kicking the context each time.
+   */
+  void run(unsigned long int millis)
+  {
+    for (unsigned long int i = 0; i < millis; i++)
+    {
+      uptimeInfo.setTMillis(uptimeInfo.tMillis() + 1);
+      scheduleTimers();
+    }
+  }
+
+  /**
+   * Time elapsed since the test started.
+   */
+  unsigned long int elapsed(unsigned long int millis)
+  {
+    return millis - std::get<1>(GetParam());
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerHeap heap;
+  SpinTimerWheel wheel;
+  SpinTimerScan scan;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Group Tests
+
+TEST_P(SpinTimerGroupTest, group_membership_test)
+{
+  SpinTimerGroup group;
+  SpinTimerGroup otherGroup;
+  SpinTimer timer1(10);
+  EXPECT_EQ(nullptr, timer1.group());
+  {
+    SpinTimer timer2(10);
+    group.add(&timer1);
+    group.add(&timer2);
+    group.add(&timer2);
+    EXPECT_EQ(2U, group.size());
+    EXPECT_EQ(&group, timer2.group());
+  }
+  // destroyed timer left the group
+  EXPECT_EQ(1U, group.size());
+
+  otherGroup.add(&timer1);
+  EXPECT_EQ(0U, group.size());
+  EXPECT_EQ(1U, otherGroup.size());
+  EXPECT_EQ(&otherGroup, timer1.group());
+
+  otherGroup.remove(&timer1);
+  EXPECT_EQ(0U, otherGroup.size());
+  EXPECT_EQ(nullptr, timer1.group());
+}
+
+TEST_P(SpinTimerGroupTest, group_start_cancel_test)
+{
+  GroupCountingSpinTimerAction action1;
+  GroupCountingSpinTimerAction action2;
+  SpinTimer timer1(20, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  SpinTimer timer2(30, &action2, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  SpinTimerGroup group;
+  group.add(&timer1);
+  group.add(&timer2);
+
+  group.start();
+  EXPECT_TRUE(timer1.isRunning());
+  EXPECT_TRUE(timer2.isRunning());
+  run(10);
+
+  // all the members stop at once
+  group.cancel();
+  EXPECT_FALSE(timer1.isRunning());
+  EXPECT_FALSE(timer2.isRunning());
+  run(100);
+  EXPECT_EQ(0UL, action1.count);
+  EXPECT_EQ(0UL, action2.count);
+
+  // a member started again runs
+  timer1.start();
+  EXPECT_TRUE(timer1.isRunning());
+  EXPECT_FALSE(timer2.isRunning());
+  run(20);
+  EXPECT_EQ(1UL, action1.count);
+  EXPECT_EQ(0UL, action2.count);
+}
+
+TEST_P(SpinTimerGroupTest, group_reinterval_test)
+{
+  GroupCountingSpinTimerAction action1;
+  GroupCountingSpinTimerAction action2;
+  SpinTimer timer1(20, &action1, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(30, &action2, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimerGroup group;
+  group.add(&timer1);
+  group.add(&timer2);
+
+  group.start(50);
+  EXPECT_EQ(50UL, timer1.getInterval());
+  EXPECT_EQ(50UL, timer2.getInterval());
+  run(49);
+  EXPECT_EQ(0UL, action1.count);
+  EXPECT_EQ(0UL, action2.count);
+  run(1);
+  EXPECT_EQ(1UL, action1.count);
+  EXPECT_EQ(1UL, action2.count);
+}
+
+TEST_P(SpinTimerGroupTest, group_pause_resume_test)
+{
+  GroupCountingSpinTimerAction action1;
+  GroupCountingSpinTimerAction action2;
+  GroupCountingSpinTimerAction action3;
+  SpinTimer timer1(100, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(300, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer3(40, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  SpinTimerGroup group;
+  group.add(&timer1);
+  group.add(&timer2);
+  group.add(&timer3);
+
+  run(30);
+  group.pause();
+  EXPECT_TRUE(group.isPaused());
+
+  // started while paused, starts counting with resume()
+  run(10);
+  timer3.start();
+
+  run(190);
+  EXPECT_EQ(0UL, action1.count);
+  EXPECT_EQ(0UL, action2.count);
+  EXPECT_EQ(0UL, action3.count);
+  EXPECT_TRUE(timer1.isRunning());
+  EXPECT_TRUE(timer2.isRunning());
+  EXPECT_TRUE(timer3.isRunning());
+
+  // paused for 200 ms
+  group.resume();
+  EXPECT_FALSE(group.isPaused());
+  run(100);
+  EXPECT_EQ(1UL, action1.count);
+  EXPECT_EQ(300UL, elapsed(action1.lastMillis));
+  EXPECT_EQ(1UL, action3.count);
+  EXPECT_EQ(270UL, elapsed(action3.lastMillis));
+  run(200);
+  EXPECT_EQ(1UL, action2.count);
+  EXPECT_EQ(500UL, elapsed(action2.lastMillis));
+}
+
+TEST_P(SpinTimerGroupTest, group_remove_paused_test)
+{
+  GroupCountingSpinTimerAction action;
+  SpinTimer timer(100, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimerGroup group;
+  group.add(&timer);
+
+  run(30);
+  group.pause();
+  run(200);
+
+  // continues with its remaining time
+  group.remove(&timer);
+  run(70);
+  EXPECT_EQ(1UL, action.count);
+  EXPECT_EQ(300UL, elapsed(action.lastMillis));
+}
+
+TEST_P(SpinTimerGroupTest, group_restart_member_test)
+{
+  GroupCountingSpinTimerAction action;
+  SpinTimer timer(100, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimerGroup group;
+  group.add(&timer);
+
+  run(30);
+  group.pause();
+  run(50);
+  group.resume();
+
+  // restarted after the pause, the deadline gets 100 ms after the restart
+  run(10);
+  timer.restart();
+  run(99);
+  EXPECT_EQ(0UL, action.count);
+  run(1);
+  EXPECT_EQ(1UL, action.count);
+
+  // cancelled by the group after a restart
+  timer.start();
+  run(10);
+  timer.restart();
+  group.cancel();
+  run(200);
+  EXPECT_EQ(1UL, action.count);
+}
+
+#ifdef SPINTIMER_BUDGET
+TEST_P(SpinTimerGroupTest, group_cancel_pending_notification_test)
+{
+  GroupCountingSpinTimerAction action1;
+  GroupCountingSpinTimerAction action2;
+  SpinTimer timer1(10, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(10, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimerGroup group;
+  group.add(&timer1);
+  group.add(&timer2);
+
+  // one notification per call, the other one is kept pending
+  uptimeInfo.setTMillis(uptimeInfo.tMillis() + 10);
+  SpinTimerContext::instance()->handleTick(SpinTimerContext::NO_TIME_BUDGET, 1);
+  EXPECT_EQ(1UL, action1.count + action2.count);
+  EXPECT_EQ(1UL, SpinTimerContext::instance()->pendingCount());
+
+  group.cancel();
+  SpinTimerContext::instance()->handleTick();
+  EXPECT_EQ(1UL, action1.count + action2.count);
+  EXPECT_EQ(0UL, SpinTimerContext::instance()->pendingCount());
+}
+#endif
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimer,
+    SpinTimerGroupTest,
+    ::testing::Combine(
+        ::testing::Values(0, 1, 2, 3),
+        ::testing::Values(0UL, ULONG_MAX - 100)));
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+// First: delayMillis Second: startMillis
+typedef std::tuple<unsigned long int, unsigned long int> SpinTimerHeapTestParam;
+
+class SpinTimerHeapTest : public ::testing::TestWithParam<SpinTimerHeapTestParam>
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerHeap heap;
+};
+
+class OrderRecordingSpinTimerAction : public SpinTimerAction
+{
+public:
+  OrderRecordingSpinTimerAction(std::vector<int>& order, int id) : m_order(order), m_id(id) { }
+  void timeExpired() { m_order.push_back(m_id); }
+
+private:
+  std::vector<int>& m_order;
+  int m_id;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Heap Tests
+
+TEST_P(SpinTimerHeapTest, timer_heap_singleShot_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+  unsigned long int expEndMillis = startMillis + delayMillis;
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&heap);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(delayMillis, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+  while (uptimeInfo.tMillis() != expEndMillis)
+  {
+    scheduleTimers();
+    EXPECT_TRUE(timer.isRunning());
+    uptimeInfo.incrementTMillis();
+  }
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+
+  uptimeInfo.incrementTMillis();
+  scheduleTimers();
+}
+
+TEST_F(SpinTimerHeapTest, timer_heap_dispatchOrder_test)
+{
+  std::vector<int> order;
+  uptimeInfo.setTMillis(ULONG_MAX - 20);
+  SpinTimerContext::instance()->setEngine(&heap);
+
+  OrderRecordingSpinTimerAction action1(order, 1);
+  OrderRecordingSpinTimerAction action2(order, 2);
+  OrderRecordingSpinTimerAction action3(order, 3);
+  SpinTimer timer3(30, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer1(10, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(20, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // all of them are due with the same pass
+  uptimeInfo.setTMillis(ULONG_MAX - 20 + 100);
+  scheduleTimers();
+  ASSERT_EQ(order.size(), 3U);
+  EXPECT_EQ(order[0], 1);
+  EXPECT_EQ(order[1], 2);
+  EXPECT_EQ(order[2], 3);
+}
+
+TEST_F(SpinTimerHeapTest, timer_heap_cancelAndRestart_test)
+{
+  uptimeInfo.setTMillis(0);
+  SpinTimerContext::instance()->setEngine(&heap);
+
+  Mock_SpinTimerAction timerAction1;
+  Mock_SpinTimerAction timerAction2;
+  SpinTimer timer1(100, &timerAction1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(200, &timerAction2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction1, timeExpired).Times(Exactly(0));
+  EXPECT_CALL(timerAction2, timeExpired).Times(Exactly(1));
+
+  uptimeInfo.setTMillis(50);
+  timer1.cancel();
+  timer2.start(100);
+  uptimeInfo.setTMillis(149);
+  scheduleTimers();
+  EXPECT_TRUE(timer2.isRunning());
+  uptimeInfo.setTMillis(150);
+  scheduleTimers();
+  EXPECT_FALSE(timer2.isRunning());
+}
+
+TEST_F(SpinTimerHeapTest, timer_heap_recurringZero_test)
+{
+  uptimeInfo.setTMillis(0);
+  SpinTimerContext::instance()->setEngine(&heap);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(0, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(3));
+
+  // expires once per pass
+  scheduleTimers();
+  scheduleTimers();
+  scheduleTimers();
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimerHeap,
+    SpinTimerHeapTest,
+    ::testing::Values(
+        // DelayMillis | StartMillis
+        std::make_tuple(0, 0),
+        std::make_tuple(10, ULONG_MAX),
+        std::make_tuple(10, ULONG_MAX - 10),
+        std::make_tuple(5000, ULONG_MAX - 1000)
+        ));
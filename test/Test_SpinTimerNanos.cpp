@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerWheel.h"
+#include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class Mock_NanosUptimeInfo : public UptimeInfoAdapter
+{
+public:
+  Mock_NanosUptimeInfo() : m_Ticks(0) { }
+
+  void setTTicks(SpinTimerTick ticks) { m_Ticks = ticks; }
+  void addTTicks(SpinTimerTick ticks) { m_Ticks += ticks; }
+
+  // UptimeInfo interface
+  unsigned long tMillis() { return static_cast<unsigned long>(m_Ticks / SPINTIMER_TICKS_PER_MILLI); }
+  SpinTimerTick tTicks()  { return m_Ticks; }
+
+private:
+  SpinTimerTick m_Ticks;
+};
+
+class SpinTimerNanosTest : public ::testing::TestWithParam<int>
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    uptimeInfo.setTTicks(0);
+    switch (GetParam())
+    {
+      case 1:  SpinTimerContext::instance()->setEngine(&heap);  break;
+      case 2:  SpinTimerContext::instance()->setEngine(&wheel); break;
+      default: SpinTimerContext::instance()->setEngine(0);      break;
+    }
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  Mock_NanosUptimeInfo uptimeInfo;
+  SpinTimerHeap heap;
+  SpinTimerWheel wheel;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Nanoseconds Time Base Tests
+
+TEST(SpinTimerNanos, timer_nanos_timeBase_test)
+{
+  EXPECT_EQ(sizeof(SpinTimerTick), 8U);
+  EXPECT_EQ(SPINTIMER_TICKS_PER_MILLI, 1000000ULL);
+}
+
+TEST_P(SpinTimerNanosTest, timer_nanos_subMillisecondRecurring_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(0, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  timer.startTicks(250000);
+  EXPECT_EQ(timer.getIntervalTicks(), 250000ULL);
+  EXPECT_EQ(timer.getInterval(), 0UL);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(4));
+
+  // 4 expirations within 1 ms, 1 us resolution
+  for (unsigned int i = 0; i < 1000; i++)
+  {
+    uptimeInfo.addTTicks(1000);
+    scheduleTimers();
+  }
+}
+
+TEST_P(SpinTimerNanosTest, timer_nanos_nextExpiry_test)
+{
+  SpinTimer timer(0, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  EXPECT_EQ(SpinTimerContext::instance()->nextExpiryTicks(), SpinTimerContext::NO_EXPIRY_TICKS);
+
+  timer.startTicks(1500000);
+  uptimeInfo.addTTicks(1000);
+  EXPECT_LE(SpinTimerContext::instance()->nextExpiryTicks(), 1499000ULL);
+  EXPECT_EQ(SpinTimerContext::instance()->nextExpiryMillis(), 2UL);
+  scheduleTimers();
+  EXPECT_TRUE(timer.isRunning());
+
+  uptimeInfo.addTTicks(1499000);
+  EXPECT_EQ(SpinTimerContext::instance()->nextExpiryTicks(), 0ULL);
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+}
+
+TEST_P(SpinTimerNanosTest, timer_nanos_millisecondsApi_test)
+{
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(5, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_EQ(timer.getIntervalTicks(), 5000000ULL);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+  uptimeInfo.addTTicks(4999999);
+  scheduleTimers();
+  EXPECT_TRUE(timer.isRunning());
+  uptimeInfo.addTTicks(1);
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimerNanos,
+    SpinTimerNanosTest,
+    ::testing::Values(0, 1, 2)); // Engine: none | SpinTimerHeap | SpinTimerWheel
+
+TEST(SpinTimerNanos, timer_nanos_monotonicAdapter_test)
+{
+  MonotonicUptimeInfoAdapter adapter;
+  SpinTimerTick t1 = adapter.tTicks();
+  SpinTimerTick t2 = adapter.tTicks();
+  EXPECT_LE(t1, t2);
+  EXPECT_LT(t2, 1000000000ULL);
+  EXPECT_EQ(adapter.tMillis(), 0UL);
+}
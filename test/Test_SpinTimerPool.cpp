@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerPool.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class SpinTimerPoolTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  void run(unsigned long int millis)
+  {
+    for (unsigned long int i = 0; i < millis; i++)
+    {
+      uptimeInfo.incrementTMillis();
+      scheduleTimers();
+    }
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pool Tests
+
+TEST_F(SpinTimerPoolTest, timer_pool_createAndExpire_test)
+{
+  SpinTimerPool<4> pool;
+  Mock_SpinTimerAction timerAction;
+  SpinTimerHandle handle = pool.create(10, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_FALSE(handle.isNull());
+  EXPECT_TRUE(pool.isValid(handle));
+  EXPECT_TRUE(pool.isRunning(handle));
+  EXPECT_EQ(pool.size(), 1U);
+  EXPECT_EQ(pool.timer(handle)->context(), SpinTimerContext::current());
+
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+  run(10);
+  EXPECT_FALSE(pool.isRunning(handle));
+  EXPECT_TRUE(pool.isExpired(handle));
+
+  EXPECT_TRUE(pool.start(handle, 5));
+  run(4);
+  EXPECT_FALSE(pool.isExpired(handle));
+  uptimeInfo.incrementTMillis();
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+  EXPECT_TRUE(pool.isExpired(handle));
+}
+
+TEST_F(SpinTimerPoolTest, timer_pool_staleHandle_test)
+{
+  SpinTimerPool<1> pool;
+  Mock_SpinTimerAction timerAction;
+  SpinTimerHandle handle = pool.create(10, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_TRUE(pool.release(handle));
+  EXPECT_FALSE(pool.isValid(handle));
+  EXPECT_FALSE(pool.release(handle));
+  EXPECT_EQ(pool.size(), 0U);
+
+  // the released timer got detached, no expiration
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(0));
+  run(20);
+
+  // slot gets reused, the old handle stays stale
+  SpinTimerHandle newHandle = pool.create(10);
+  EXPECT_FALSE(newHandle.isNull());
+  EXPECT_NE(newHandle, handle);
+  EXPECT_TRUE(pool.isValid(newHandle));
+  EXPECT_FALSE(pool.isValid(handle));
+  EXPECT_EQ(pool.timer(handle), nullptr);
+  EXPECT_FALSE(pool.start(handle));
+  EXPECT_FALSE(pool.cancel(handle));
+  EXPECT_FALSE(pool.restart(handle));
+  EXPECT_FALSE(pool.isRunning(handle));
+  EXPECT_FALSE(pool.isExpired(handle));
+  EXPECT_FALSE(pool.isValid(SpinTimerHandle()));
+}
+
+TEST_F(SpinTimerPoolTest, timer_pool_exhausted_test)
+{
+  SpinTimerPool<3> pool;
+  SpinTimerHandle handles[3];
+  for (unsigned int i = 0; i < pool.capacity(); i++)
+  {
+    handles[i] = pool.create(10);
+    EXPECT_TRUE(pool.isValid(handles[i]));
+  }
+  EXPECT_TRUE(pool.create(10).isNull());
+
+  EXPECT_TRUE(pool.release(handles[1]));
+  EXPECT_FALSE(pool.create(10).isNull());
+  EXPECT_TRUE(pool.isValid(handles[0]));
+  EXPECT_TRUE(pool.isValid(handles[2]));
+}
+
+TEST_F(SpinTimerPoolTest, timer_pool_context_test)
+{
+  SpinTimerContext context;
+  SpinTimerPool<2> pool(&context);
+  Mock_SpinTimerAction timerAction;
+  SpinTimerHandle handle = pool.create(5, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_EQ(pool.timer(handle)->context(), &context);
+
+  // default context does not kick the pooled timer
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(0));
+  run(5);
+
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+  context.handleTick();
+  EXPECT_TRUE(pool.cancel(handle));
+  EXPECT_FALSE(pool.isRunning(handle));
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <tuple>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerWheel.h"
+#include "SpinTimerScan.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class RestartCountingSpinTimerAction : public SpinTimerAction
+{
+public:
+  RestartCountingSpinTimerAction() : count(0) { }
+  void timeExpired() { count++; }
+  unsigned long count;
+};
+
+// First: engine (0: none, 1: SpinTimerHeap, 2: SpinTimerWheel, 3: SpinTimerScan) Second: startMillis
+typedef std::tuple<int, unsigned long int> SpinTimerRestartTestParam;
+
+class SpinTimerRestart : public ::testing::TestWithParam<SpinTimerRestartTestParam>
+{
+protected:
+  void SetUp()
+  {
+    uptimeInfo.setTMillis(std::get<1>(GetParam()));
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+    SpinTimerEngine* engines[] = { 0, &heap, &wheel, &scan };
+    SpinTimerContext::instance()->setEngine(engines[std::get<0>(GetParam())]);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  /**
+   * Advance the up-time millisecond by millisecond, kicking the context each time.
+   */
+  void run(unsigned long int millis)
+  {
+    for (unsigned long int i = 0; i < millis; i++)
+    {
+      uptimeInfo.setTMillis(uptimeInfo.tMillis() + 1);
+      scheduleTimers();
+    }
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerHeap heap;
+  SpinTimerWheel wheel;
+  SpinTimerScan scan;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Restart Tests
+
+TEST_P(SpinTimerRestart, restart_postpones_expiration_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer watchdog(100, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // restarted every 30 ms, never expires
+  for (int i = 0; i < 10; i++)
+  {
+    run(30);
+    watchdog.restart();
+  }
+  EXPECT_EQ(0UL, action.count);
+  EXPECT_TRUE(watchdog.isRunning());
+
+  // expires 100 ms after the latest restart
+  run(99);
+  EXPECT_EQ(0UL, action.count);
+  run(1);
+  EXPECT_EQ(1UL, action.count);
+  EXPECT_FALSE(watchdog.isRunning());
+}
+
+TEST_P(SpinTimerRestart, restart_is_lazy_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer watchdog(100, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  run(50);
+  watchdog.restart();
+
+  // the timer is kept at the previous deadline (a lower bound of the new one) until it comes up,
+  // the engines may report an even earlier wakeup
+  EXPECT_GE(50 * SPINTIMER_TICKS_PER_MILLI, SpinTimerContext::instance()->nextExpiryTicks());
+  run(50);
+  EXPECT_EQ(0UL, action.count);
+  EXPECT_GE(50 * SPINTIMER_TICKS_PER_MILLI, SpinTimerContext::instance()->nextExpiryTicks());
+  run(50);
+  EXPECT_EQ(1UL, action.count);
+}
+
+TEST_P(SpinTimerRestart, restart_stopped_timer_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer timer(20, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+
+  timer.restart();
+  EXPECT_TRUE(timer.isRunning());
+  run(20);
+  EXPECT_EQ(1UL, action.count);
+
+  // restart after the expiration
+  timer.restart();
+  run(19);
+  EXPECT_EQ(1UL, action.count);
+  run(1);
+  EXPECT_EQ(2UL, action.count);
+}
+
+TEST_P(SpinTimerRestart, restart_cancel_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer timer(20, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  run(10);
+  timer.restart();
+  timer.cancel();
+  run(100);
+  EXPECT_EQ(0UL, action.count);
+  EXPECT_FALSE(timer.isRunning());
+}
+
+TEST_P(SpinTimerRestart, restart_late_kick_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer timer(20, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  run(10);
+  timer.restart();
+
+  // both the previous and the new deadline have passed when the context gets kicked
+  uptimeInfo.setTMillis(uptimeInfo.tMillis() + 200);
+  scheduleTimers();
+  EXPECT_EQ(1UL, action.count);
+  EXPECT_FALSE(timer.isRunning());
+}
+
+TEST_P(SpinTimerRestart, restart_time_snapshot_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer timer(20, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+
+  SpinTimerTick eventTicks = UptimeInfo::Instance()->tTicks();
+  run(10);
+  timer.start();
+
+  // time stamp taken before the running interval started, the timer gets re-scheduled right away
+  timer.restart(eventTicks);
+  run(9);
+  EXPECT_EQ(0UL, action.count);
+  run(1);
+  EXPECT_EQ(1UL, action.count);
+}
+
+TEST_P(SpinTimerRestart, restart_recurring_test)
+{
+  RestartCountingSpinTimerAction action;
+  SpinTimer timer(20, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  run(15);
+  timer.restart();
+
+  // the period continues from the restart
+  run(19);
+  EXPECT_EQ(0UL, action.count);
+  run(1);
+  EXPECT_EQ(1UL, action.count);
+  run(20);
+  EXPECT_EQ(2UL, action.count);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimer,
+    SpinTimerRestart,
+    ::testing::Combine(
+        ::testing::Values(0, 1, 2, 3),
+        ::testing::Values(0UL, ULONG_MAX - 60)));
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerScan.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+// First: delayMillis Second: startMillis
+typedef std::tuple<unsigned long int, unsigned long int> SpinTimerScanTestParam;
+
+class SpinTimerScanTest : public ::testing::TestWithParam<SpinTimerScanTestParam>
+{
+protected:
+  SpinTimerScanTest()
+  : scan(2)   // small capacity, let the arrays grow
+  { }
+
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerScan scan;
+};
+
+class ExpiryRecordingSpinTimerAction : public SpinTimerAction
+{
+public:
+  ExpiryRecordingSpinTimerAction() : m_count(0), m_lastMillis(0) { }
+  void timeExpired() { m_count++; m_lastMillis = UptimeInfo::tMillis(); }
+
+  unsigned int m_count;
+  unsigned long m_lastMillis;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Scan Tests
+
+TEST_P(SpinTimerScanTest, timer_scan_singleShot_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+  unsigned long int expEndMillis = startMillis + delayMillis;
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&scan);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(delayMillis, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+  while (uptimeInfo.tMillis() != expEndMillis)
+  {
+    scheduleTimers();
+    EXPECT_TRUE(timer.isRunning());
+    uptimeInfo.incrementTMillis();
+  }
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+
+  uptimeInfo.incrementTMillis();
+  scheduleTimers();
+}
+
+TEST_P(SpinTimerScanTest, timer_scan_manyTimers_test)
+{
+  unsigned long int startMillis = std::get<1>(GetParam());
+  const unsigned int numOfTimers = 37;  // odd count, vector and scalar compares involved
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&scan);
+
+  std::vector<ExpiryRecordingSpinTimerAction> actions(numOfTimers);
+  std::vector<SpinTimer*> timers;
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    // interleaved deadlines, timers get removed from the middle of the arrays
+    timers.push_back(new SpinTimer((i * 7) % 23 + 1, &actions[i], SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART));
+  }
+  timers[5]->cancel();
+
+  for (unsigned int t = 0; t < 30; t++)
+  {
+    uptimeInfo.incrementTMillis();
+    scheduleTimers();
+  }
+
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    if (5 == i)
+    {
+      EXPECT_EQ(actions[i].m_count, 0U);
+    }
+    else
+    {
+      EXPECT_EQ(actions[i].m_count, 1U);
+      EXPECT_EQ(actions[i].m_lastMillis, startMillis + (i * 7) % 23 + 1);
+    }
+    delete timers[i];
+  }
+}
+
+TEST_P(SpinTimerScanTest, timer_scan_cancelAndRestart_test)
+{
+  unsigned long int startMillis = std::get<1>(GetParam());
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&scan);
+
+  Mock_SpinTimerAction timerAction1;
+  Mock_SpinTimerAction timerAction2;
+  SpinTimer timer1(100, &timerAction1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(200, &timerAction2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction1, timeExpired).Times(Exactly(0));
+  EXPECT_CALL(timerAction2, timeExpired).Times(Exactly(1));
+
+  uptimeInfo.setTMillis(startMillis + 50);
+  timer1.cancel();
+  timer2.start(100);
+  EXPECT_EQ(SpinTimerContext::instance()->nextExpiryMillis(), 100U);
+  uptimeInfo.setTMillis(startMillis + 149);
+  scheduleTimers();
+  EXPECT_TRUE(timer2.isRunning());
+  uptimeInfo.setTMillis(startMillis + 150);
+  scheduleTimers();
+  EXPECT_FALSE(timer2.isRunning());
+  EXPECT_EQ(SpinTimerContext::instance()->nextExpiryMillis(), SpinTimerContext::NO_EXPIRY);
+}
+
+TEST_P(SpinTimerScanTest, timer_scan_recurring_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&scan);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(delayMillis, &timerAction, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(3));
+
+  // expires once per pass at least
+  for (unsigned int i = 0; i < 3; i++)
+  {
+    uptimeInfo.setTMillis(uptimeInfo.tMillis() + delayMillis);
+    scheduleTimers();
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimerScan,
+    SpinTimerScanTest,
+    ::testing::Values(
+        // DelayMillis | StartMillis
+        std::make_tuple(0, 0),
+        std::make_tuple(10, ULONG_MAX),
+        std::make_tuple(10, ULONG_MAX - 10),
+        std::make_tuple(5000, ULONG_MAX - 1000)
+        ));
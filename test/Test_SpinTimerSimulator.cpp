@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "SpinTimerSimulator.h"
+#include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "Mock_UptimeInfo.h"
+#include "CountingSpinTimerAction.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class StampRecordingSpinTimerAction : public SpinTimerAction
+{
+public:
+  StampRecordingSpinTimerAction(std::vector<std::pair<unsigned long, int> >& stamps, int id) : m_stamps(stamps), m_id(id) { }
+  void timeExpired() { m_stamps.push_back(std::make_pair(UptimeInfo::Instance()->tMillis(), m_id)); }
+
+private:
+  std::vector<std::pair<unsigned long, int> >& m_stamps;
+  int m_id;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Simulator Tests
+
+TEST(SpinTimerSimulator, simulator_adapter_restore_test)
+{
+  Mock_UptimeInfo uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  {
+    SpinTimerSimulator simulator;
+    EXPECT_EQ(&simulator.clock(), UptimeInfo::adapter());
+    simulator.run(1234);
+    EXPECT_EQ(1234UL, UptimeInfo::Instance()->tMillis());
+  }
+  EXPECT_EQ(&uptimeInfo, UptimeInfo::adapter());
+
+  // the mock goes out of scope, leave a live adapter behind
+  static MonotonicUptimeInfoAdapter s_uptimeInfo;
+  UptimeInfo::Instance()->setAdapter(&s_uptimeInfo);
+}
+
+TEST(SpinTimerSimulator, simulator_longSchedule_test)
+{
+  SpinTimerSimulator simulator;
+  CountingSpinTimerAction action;
+  SpinTimer timer(1000, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // 10 hours, one kick per expiration
+  EXPECT_EQ(36000UL, simulator.run(10UL * 3600 * 1000));
+  EXPECT_EQ(36000UL, action.count());
+  EXPECT_EQ(36000000UL, UptimeInfo::Instance()->tMillis());
+}
+
+TEST(SpinTimerSimulator, simulator_deterministicOrder_test)
+{
+  SpinTimerSimulator simulator;
+  std::vector<std::pair<unsigned long, int> > stamps;
+  StampRecordingSpinTimerAction action1(stamps, 1);
+  StampRecordingSpinTimerAction action2(stamps, 2);
+  StampRecordingSpinTimerAction action3(stamps, 3);
+  SpinTimer timer1(300, &action1, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(200, &action2, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer3(500, &action3, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  simulator.run(650);
+
+  std::vector<std::pair<unsigned long, int> > expected;
+  expected.push_back(std::make_pair(200UL, 2));
+  expected.push_back(std::make_pair(300UL, 1));
+  expected.push_back(std::make_pair(400UL, 2));
+  expected.push_back(std::make_pair(500UL, 3));
+  expected.push_back(std::make_pair(600UL, 1));
+  expected.push_back(std::make_pair(600UL, 2));
+  EXPECT_EQ(expected, stamps);
+  EXPECT_EQ(650UL, UptimeInfo::Instance()->tMillis());
+}
+
+TEST(SpinTimerSimulator, simulator_engine_test)
+{
+  SpinTimerHeap heap;
+  SpinTimerSimulator simulator;
+
+  // the engine gets reset to the simulated time
+  SpinTimerContext::instance()->setEngine(&heap);
+  {
+    CountingSpinTimerAction action;
+    SpinTimer timer(7, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+    simulator.run(7000);
+    EXPECT_EQ(1000UL, action.count());
+  }
+  SpinTimerContext::instance()->setEngine(0);
+}
+
+TEST(SpinTimerSimulator, simulator_step_test)
+{
+  SpinTimerSimulator simulator;
+  CountingSpinTimerAction action;
+  SpinTimer timer(250, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  EXPECT_TRUE(simulator.step());
+  EXPECT_EQ(1UL, action.count());
+  EXPECT_EQ(250UL, UptimeInfo::Instance()->tMillis());
+
+  // no timer running, the time stands still
+  EXPECT_FALSE(simulator.step());
+  EXPECT_EQ(250UL, UptimeInfo::Instance()->tMillis());
+}
+
+TEST(SpinTimerSimulator, simulator_zeroInterval_test)
+{
+  SpinTimerSimulator simulator;
+  CountingSpinTimerAction action;
+  SpinTimer timer(0, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // fires once per tick, does not stall the simulation
+  simulator.runTicks(10);
+  EXPECT_EQ(11UL, action.count());
+}
+
+TEST(SpinTimerSimulator, simulator_speedFactor_test)
+{
+  SpinTimerSimulator simulator;
+  CountingSpinTimerAction action;
+  SpinTimer timer(100, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  simulator.setSpeedFactor(1000.0);
+  simulator.run(1000);
+  EXPECT_EQ(10UL, action.count());
+}
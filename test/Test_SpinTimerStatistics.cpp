@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerHeap.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+/**
+ * Action consuming time, by advancing the mocked up-time.
+ */
+class TimeConsumingSpinTimerAction : public SpinTimerAction
+{
+public:
+  TimeConsumingSpinTimerAction(Mock_UptimeInfo& uptimeInfo, unsigned long millis)
+  : m_uptimeInfo(uptimeInfo)
+  , m_millis(millis)
+  { }
+
+  void timeExpired() { m_uptimeInfo.setTMillis(m_uptimeInfo.tMillis() + m_millis); }
+
+  Mock_UptimeInfo& m_uptimeInfo;
+  unsigned long m_millis;
+};
+
+class SpinTimerStatisticsTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+
+    // own context, not visiting the timers other tests leave attached to the process wide instance (i.e. a sleep queue)
+    context.makeCurrent();
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->makeCurrent();
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerContext context;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Statistics Tests
+
+TEST_F(SpinTimerStatisticsTest, timer_statistics_lateness_test)
+{
+  SpinTimer timer(10, 0, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // on time
+  uptimeInfo.setTMillis(10);
+  scheduleTimers();
+  // 5 ms late
+  uptimeInfo.setTMillis(25);
+  scheduleTimers();
+  // 100 ms late
+  uptimeInfo.setTMillis(135);
+  scheduleTimers();
+
+  const SpinTimerStatistics& statistics = timer.statistics();
+  EXPECT_EQ(statistics.fireCount, 3U);
+  EXPECT_EQ(statistics.maxLatenessTicks, 100U);
+  EXPECT_EQ(statistics.latenessHistogram[0], 1U);
+  EXPECT_EQ(statistics.latenessHistogram[3], 1U);   // 4 .. 7
+  EXPECT_EQ(statistics.latenessHistogram[7], 1U);   // 64 .. 127
+
+  timer.resetStatistics();
+  EXPECT_EQ(timer.statistics().fireCount, 0U);
+  EXPECT_EQ(timer.statistics().maxLatenessTicks, 0U);
+}
+
+#ifdef SPINTIMER_BUDGET
+TEST_F(SpinTimerStatisticsTest, timer_statistics_deferredLateness_test)
+{
+  TimeConsumingSpinTimerAction action1(uptimeInfo, 0);
+  TimeConsumingSpinTimerAction action2(uptimeInfo, 0);
+  SpinTimer timer1(10, &action1, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(10, &action2, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // both detected on time, one notification per call, the other one gets notified 5 ms late
+  uptimeInfo.setTMillis(10);
+  context.handleTick(SpinTimerContext::NO_TIME_BUDGET, 1);
+  uptimeInfo.setTMillis(15);
+  context.handleTick(SpinTimerContext::NO_TIME_BUDGET, 1);
+
+  EXPECT_EQ(timer1.statistics().fireCount, 1U);
+  EXPECT_EQ(timer2.statistics().fireCount, 1U);
+  EXPECT_EQ(timer1.statistics().maxLatenessTicks + timer2.statistics().maxLatenessTicks, 5U);
+}
+#endif
+
+TEST_F(SpinTimerStatisticsTest, timer_statistics_callbackDuration_test)
+{
+  TimeConsumingSpinTimerAction action(uptimeInfo, 7);
+  SpinTimer timer(10, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  uptimeInfo.setTMillis(10);
+  scheduleTimers();
+  EXPECT_EQ(timer.statistics().fireCount, 1U);
+  EXPECT_EQ(timer.statistics().maxCallbackTicks, 7U);
+
+  const SpinTimerContextStatistics& statistics = context.statistics();
+  EXPECT_EQ(statistics.tickCount, 1U);
+  EXPECT_EQ(statistics.lastTickTicks, 7U);
+  EXPECT_EQ(statistics.maxTickTicks, 7U);
+  EXPECT_EQ(statistics.lastVisitedCount, 1U);
+}
+
+TEST_F(SpinTimerStatisticsTest, timer_statistics_visitedCount_test)
+{
+  SpinTimerHeap heap;
+  SpinTimer timer1(10, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer2(20, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer3(30, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+
+  // without engine: all the attached timers get visited
+  scheduleTimers();
+  EXPECT_EQ(context.statistics().lastVisitedCount, 3U);
+
+  // with engine: only the expired timers get visited
+  context.setEngine(&heap);
+  uptimeInfo.setTMillis(5);
+  scheduleTimers();
+  EXPECT_EQ(context.statistics().lastVisitedCount, 0U);
+  uptimeInfo.setTMillis(20);
+  scheduleTimers();
+  EXPECT_EQ(context.statistics().lastVisitedCount, 2U);
+  EXPECT_EQ(context.statistics().maxVisitedCount, 3U);
+  EXPECT_EQ(context.statistics().tickCount, 3U);
+  context.setEngine(0);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerTrace.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class SpinTimerTraceTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  void TearDown()
+  {
+    SpinTimerTrace::uninstall();
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Trace Tests
+
+TEST_F(SpinTimerTraceTest, timer_trace_events_test)
+{
+  SpinTimerTrace trace(100);
+  EXPECT_TRUE(trace.isOpen());
+  EXPECT_EQ(trace.capacity(), 128U);
+  trace.install();
+  EXPECT_EQ(SpinTimerTrace::installed(), &trace);
+
+  SpinTimer timer(10, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_NON_AUTOSTART);
+  uptimeInfo.setTMillis(5);
+  timer.start();
+  uptimeInfo.setTMillis(15);
+  scheduleTimers();
+  timer.start(20);
+  timer.cancel();
+
+  const SpinTimerTrace::Event expEvents[] =
+  {
+    SpinTimerTrace::EVENT_START,
+    SpinTimerTrace::EVENT_TICK_BEGIN,
+    SpinTimerTrace::EVENT_EXPIRE,
+    SpinTimerTrace::EVENT_TICK_END,
+    SpinTimerTrace::EVENT_START,
+    SpinTimerTrace::EVENT_CANCEL
+  };
+  ASSERT_EQ(trace.count(), 6U);
+  for (unsigned int i = 0; i < 6; i++)
+  {
+    SpinTimerTraceRecord record;
+    ASSERT_TRUE(trace.read(i, record));
+    EXPECT_EQ(record.event, static_cast<uint32_t>(expEvents[i]));
+  }
+
+  SpinTimerTraceRecord record;
+  trace.read(0, record);
+  EXPECT_EQ(record.object, reinterpret_cast<uintptr_t>(&timer));
+  EXPECT_EQ(record.timeTicks, 5U);
+  EXPECT_EQ(record.value, 10U);
+  trace.read(1, record);
+  EXPECT_EQ(record.object, reinterpret_cast<uintptr_t>(SpinTimerContext::instance()));
+  EXPECT_EQ(record.timeTicks, 15U);
+
+  // no tracing after uninstall
+  SpinTimerTrace::uninstall();
+  timer.start();
+  EXPECT_EQ(trace.count(), 6U);
+}
+
+TEST_F(SpinTimerTraceTest, timer_trace_ringOverwrite_test)
+{
+  SpinTimerTrace trace(4);
+  trace.install();
+
+  SpinTimer timer(10);
+  for (unsigned int i = 0; i < 10; i++)
+  {
+    uptimeInfo.setTMillis(i);
+    timer.start();
+  }
+  EXPECT_EQ(trace.count(), 10U);
+
+  SpinTimerTraceRecord record;
+  EXPECT_FALSE(trace.read(5, record));
+  for (unsigned int i = 6; i < 10; i++)
+  {
+    ASSERT_TRUE(trace.read(i, record));
+    EXPECT_EQ(record.timeTicks, i);
+  }
+}
+
+TEST_F(SpinTimerTraceTest, timer_trace_concurrentWriters_test)
+{
+  SpinTimerTrace trace(4096);
+  const unsigned int numOfEvents = 1000;
+
+  std::thread writer([&trace]()
+  {
+    for (unsigned int i = 0; i < numOfEvents; i++)
+    {
+      trace.record(SpinTimerTrace::EVENT_START, &trace, i, 1);
+    }
+  });
+  for (unsigned int i = 0; i < numOfEvents; i++)
+  {
+    trace.record(SpinTimerTrace::EVENT_CANCEL, &trace, i, 2);
+  }
+  writer.join();
+
+  ASSERT_EQ(trace.count(), 2 * numOfEvents);
+  unsigned int starts = 0;
+  for (unsigned int i = 0; i < 2 * numOfEvents; i++)
+  {
+    SpinTimerTraceRecord record;
+    ASSERT_TRUE(trace.read(i, record));
+    starts += (SpinTimerTrace::EVENT_START == record.event) ? 1 : 0;
+  }
+  EXPECT_EQ(starts, numOfEvents);
+}
+
+TEST_F(SpinTimerTraceTest, timer_trace_destroyedWhileEmitting_test)
+{
+  std::atomic<bool> isStopped(false);
+  std::thread emitter([&isStopped]()
+  {
+    while (!isStopped.load())
+    {
+      SpinTimerTrace::emit(SpinTimerTrace::EVENT_EXPIRE, &isStopped, 0, 0);
+    }
+  });
+
+  // the buffers get released while being written to by the emitter
+  for (unsigned int i = 0; i < 200; i++)
+  {
+    SpinTimerTrace trace(64);
+    trace.install();
+    std::this_thread::yield();
+    if (0 == (i & 1))
+    {
+      SpinTimerTrace::uninstall();
+      EXPECT_EQ(SpinTimerTrace::installed(), nullptr);
+    }
+  }
+  isStopped = true;
+  emitter.join();
+  EXPECT_EQ(SpinTimerTrace::installed(), nullptr);
+}
+
+TEST_F(SpinTimerTraceTest, timer_trace_fileMapping_test)
+{
+  char path[] = "/tmp/spintimer-trace-XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+
+  {
+    SpinTimerTrace trace(path, 16);
+    ASSERT_TRUE(trace.isOpen());
+    trace.install();
+    SpinTimer timer(10, 0, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+    timer.cancel();
+  }
+
+  // the records are kept in the file
+  std::ifstream in(path, std::ios::binary);
+  SpinTimerTraceHeader header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  EXPECT_EQ(0, memcmp(header.magic, "SPTTRACE", 8));
+  EXPECT_EQ(header.capacity, 16U);
+  EXPECT_EQ(header.writeIndex.load(), 2U);
+  SpinTimerTraceRecord record;
+  in.read(reinterpret_cast<char*>(&record), sizeof(record));
+  EXPECT_EQ(record.event, static_cast<uint32_t>(SpinTimerTrace::EVENT_START));
+  EXPECT_EQ(record.sequence, 1U);
+  std::remove(path);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <climits>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerWheel.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+#include "CountingSpinTimerAction.h"
+#include "Mock_SpinTimerAction.h"
+
+using ::testing::Exactly;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+// First: delayMillis Second: startMillis
+typedef std::tuple<unsigned long int, unsigned long int> SpinTimerWheelTestParam;
+
+class SpinTimerWheelSingleShot : public ::testing::TestWithParam<SpinTimerWheelTestParam>
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  void TearDown()
+  {
+    SpinTimerContext::instance()->setEngine(0);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+  SpinTimerWheel wheel;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Wheel Tests
+
+TEST_P(SpinTimerWheelSingleShot, timer_wheel_singleShot_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+  unsigned long int expEndMillis = startMillis + delayMillis;
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&wheel);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(delayMillis, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+  while (uptimeInfo.tMillis() != expEndMillis)
+  {
+    scheduleTimers();
+    EXPECT_TRUE(timer.isRunning());
+    uptimeInfo.incrementTMillis();
+  }
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+
+  uptimeInfo.incrementTMillis();
+  scheduleTimers();
+}
+
+TEST_P(SpinTimerWheelSingleShot, timer_wheel_jump_test)
+{
+  unsigned long int delayMillis = std::get<0>(GetParam());
+  unsigned long int startMillis = std::get<1>(GetParam());
+
+  uptimeInfo.setTMillis(startMillis);
+  SpinTimerContext::instance()->setEngine(&wheel);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(delayMillis, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(1));
+
+  if (0 != delayMillis)
+  {
+    uptimeInfo.setTMillis(startMillis + delayMillis - 1);
+    scheduleTimers();
+    EXPECT_TRUE(timer.isRunning());
+  }
+  uptimeInfo.setTMillis(startMillis + delayMillis + 1);
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+}
+
+TEST_F(SpinTimerWheelSingleShot, timer_wheel_recurring_test)
+{
+  const unsigned long int numOfLoops = 50;
+  uptimeInfo.setTMillis(ULONG_MAX - 1000);
+  SpinTimerContext::instance()->setEngine(&wheel);
+
+  CountingSpinTimerAction action7;
+  CountingSpinTimerAction action100;
+  SpinTimer timer7(7, &action7, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+  SpinTimer timer100(100, &action100, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  for (unsigned long int i = 0; i < numOfLoops * 100; i++)
+  {
+    uptimeInfo.incrementTMillis();
+    scheduleTimers();
+  }
+  EXPECT_EQ(action7.count(), numOfLoops * 100 / 7);
+  EXPECT_EQ(action100.count(), numOfLoops);
+}
+
+TEST_F(SpinTimerWheelSingleShot, timer_wheel_cancel_test)
+{
+  uptimeInfo.setTMillis(0);
+  SpinTimerContext::instance()->setEngine(&wheel);
+
+  Mock_SpinTimerAction timerAction;
+  SpinTimer timer(5000, &timerAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  EXPECT_CALL(timerAction, timeExpired).Times(Exactly(0));
+
+  uptimeInfo.setTMillis(4999);
+  scheduleTimers();
+  timer.cancel();
+  uptimeInfo.setTMillis(10000);
+  scheduleTimers();
+  EXPECT_FALSE(timer.isRunning());
+}
+
+TEST_F(SpinTimerWheelSingleShot, timer_wheel_pollingAndEngage_test)
+{
+  uptimeInfo.setTMillis(100);
+  SpinTimer timer(300, 0, SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART);
+
+  // engage while the timer is already running
+  uptimeInfo.setTMillis(200);
+  SpinTimerContext::instance()->setEngine(&wheel);
+
+  uptimeInfo.setTMillis(399);
+  scheduleTimers();
+  EXPECT_FALSE(timer.isExpired());
+  uptimeInfo.setTMillis(400);
+  EXPECT_TRUE(timer.isExpired());
+
+  // polled expiration has re-scheduled the timer
+  uptimeInfo.setTMillis(699);
+  scheduleTimers();
+  EXPECT_FALSE(timer.isExpired());
+  uptimeInfo.setTMillis(700);
+  scheduleTimers();
+  EXPECT_TRUE(timer.isExpired());
+}
+
+TEST_F(SpinTimerWheelSingleShot, timer_wheel_timeGoingBackwards_test)
+{
+  uptimeInfo.setTMillis(10000);
+  SpinTimerContext::instance()->setEngine(&wheel);
+
+  CountingSpinTimerAction action;
+  SpinTimer timer(500, &action, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART);
+  scheduleTimers();
+
+  // decreasing time base: no time passes, the timer keeps its deadline
+  for (unsigned long int millis = 9000; millis > 0; millis -= 1000)
+  {
+    uptimeInfo.setTMillis(millis);
+    scheduleTimers();
+    EXPECT_TRUE(timer.isRunning());
+    EXPECT_GT(SpinTimerContext::instance()->nextExpiryMillis(), 0UL);
+    EXPECT_LE(SpinTimerContext::instance()->nextExpiryMillis(), 10500 - millis);
+  }
+  EXPECT_EQ(action.count(), 0UL);
+
+  uptimeInfo.setTMillis(10499);
+  scheduleTimers();
+  EXPECT_EQ(action.count(), 0UL);
+  uptimeInfo.setTMillis(10500);
+  scheduleTimers();
+  EXPECT_EQ(action.count(), 1UL);
+  EXPECT_FALSE(timer.isRunning());
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SpinTimerWheel,
+    SpinTimerWheelSingleShot,
+    ::testing::Values(
+        // DelayMillis | StartMillis
+        std::make_tuple(0, 0),
+        std::make_tuple(10, ULONG_MAX - 5),
+        std::make_tuple(64, 63),
+        std::make_tuple(4096, 4000),
+        std::make_tuple(300000, 123),
+        std::make_tuple(300000, ULONG_MAX - 1000)
+        ));
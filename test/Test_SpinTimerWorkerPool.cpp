@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "SpinTimer.h"
+#include "SpinTimerContext.h"
+#include "SpinTimerWheel.h"
+#include "SpinTimerWorkerPool.h"
+#include "UptimeInfo.h"
+#include "Mock_UptimeInfo.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper Classes
+
+class SerialCheckingSpinTimerAction : public SpinTimerAction
+{
+public:
+  SerialCheckingSpinTimerAction(unsigned int sleepMicros = 0)
+  : m_sleepMicros(sleepMicros)
+  , m_running(0)
+  , m_concurrent(0)
+  , m_count(0)
+  , m_overruns(0)
+  { }
+
+  void timeExpired()
+  {
+    if (0 != m_running++)
+    {
+      m_concurrent++;
+    }
+    if (0 != m_sleepMicros)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(m_sleepMicros));
+    }
+    m_count++;
+    m_running--;
+  }
+
+  void timeOverrun(unsigned long overrunCount)
+  {
+    m_overruns += overrunCount;
+  }
+
+  unsigned int m_sleepMicros;
+  std::atomic<unsigned int> m_running;
+  std::atomic<unsigned int> m_concurrent;
+  std::atomic<unsigned long> m_count;
+  std::atomic<unsigned long> m_overruns;
+};
+
+class BlockingSpinTimerAction : public SpinTimerAction
+{
+public:
+  BlockingSpinTimerAction()
+  : m_isBlocking(true)
+  , m_isEntered(false)
+  { }
+
+  void timeExpired()
+  {
+    m_isEntered = true;
+    while (m_isBlocking)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  std::atomic<bool> m_isBlocking;
+  std::atomic<bool> m_isEntered;
+};
+
+class SpinTimerWorkerPoolTest : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    UptimeInfo::Instance()->setAdapter(&uptimeInfo);
+  }
+
+  Mock_UptimeInfo uptimeInfo;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Worker Pool Tests
+
+TEST_F(SpinTimerWorkerPoolTest, timer_workerPool_runsActions_test)
+{
+  SpinTimerWorkerPool pool(4);
+  EXPECT_EQ(pool.numOfWorkers(), 4U);
+
+  SpinTimerContext context;
+  context.setDispatcher(&pool);
+  EXPECT_EQ(context.dispatcher(), &pool);
+
+  const unsigned int numOfTimers = 32;
+  std::vector<SerialCheckingSpinTimerAction*> actions;
+  std::vector<SpinTimer*> timers;
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    actions.push_back(new SerialCheckingSpinTimerAction(50));
+    timers.push_back(new SpinTimer(1 + i % 3, actions[i], SpinTimer::IS_RECURRING, SpinTimer::IS_AUTOSTART, &context));
+  }
+
+  // slow actions do not delay the expiration detection
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < 300; i++)
+  {
+    uptimeInfo.incrementTMillis();
+    context.handleTick();
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    // waits for the pending executions
+    delete timers[i];
+    EXPECT_EQ(actions[i]->m_count, 300UL / (1 + i % 3));
+    EXPECT_EQ(actions[i]->m_concurrent, 0U);
+    delete actions[i];
+  }
+}
+
+TEST_F(SpinTimerWorkerPoolTest, timer_workerPool_overrunsAndIsExpired_test)
+{
+  SpinTimerWorkerPool pool(2);
+  SpinTimerContext context;
+  context.setDispatcher(&pool);
+
+  SerialCheckingSpinTimerAction action;
+  SpinTimer timer(10, &action, SpinTimer::IS_RECURRING, SpinTimer::IS_NON_AUTOSTART, &context);
+  timer.setRecurringPolicy(SpinTimer::FIXED_RATE_SKIP);
+  timer.start();
+
+  uptimeInfo.setTMillis(35);
+  EXPECT_TRUE(timer.isExpired());
+  uptimeInfo.setTMillis(40);
+  context.handleTick();
+  timer.cancel();
+
+  while (action.m_count < 2)
+  {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(action.m_count, 2UL);
+  EXPECT_EQ(action.m_overruns, 2UL);
+}
+
+TEST_F(SpinTimerWorkerPoolTest, timer_workerPool_stealsFromBlockedWorker_test)
+{
+  SpinTimerWorkerPool pool(2);
+  SpinTimerContext context;
+  context.setDispatcher(&pool);
+
+  // one worker gets blocked, the other one runs all the other timers, also the ones handed over to the blocked worker
+  BlockingSpinTimerAction blockingAction;
+  SpinTimer blockingTimer(10, &blockingAction, SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART, &context);
+  const unsigned int numOfTimers = 7;
+  SerialCheckingSpinTimerAction actions[numOfTimers];
+  std::vector<SpinTimer*> timers;
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    timers.push_back(new SpinTimer(10, &actions[i], SpinTimer::IS_NON_RECURRING, SpinTimer::IS_AUTOSTART, &context));
+  }
+
+  uptimeInfo.setTMillis(10);
+  context.handleTick();
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    while (0 == actions[i].m_count)
+    {
+      std::this_thread::yield();
+    }
+  }
+  while (!blockingAction.m_isEntered)
+  {
+    std::this_thread::yield();
+  }
+  EXPECT_TRUE(blockingAction.m_isBlocking);
+
+  blockingAction.m_isBlocking = false;
+  for (unsigned int i = 0; i < numOfTimers; i++)
+  {
+    delete timers[i];
+  }
+}
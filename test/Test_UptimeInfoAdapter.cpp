@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <time.h>
+
+#include "UptimeInfo.h"
+#include "MonotonicUptimeInfoAdapter.h"
+#include "TscUptimeInfoAdapter.h"
+
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static void sleepMillis(unsigned long millis)
+{
+  struct timespec delay;
+  delay.tv_sec = millis / 1000;
+  delay.tv_nsec = static_cast<long>((millis % 1000) * 1000000L);
+  nanosleep(&delay, 0);
+}
+
+/**
+ * Check an adapter starting near zero, counting monotonically and advancing with the time slept.
+ */
+static void expectUptime(UptimeInfoAdapter& adapter, unsigned long resolutionMillis)
+{
+  unsigned long start = adapter.tMillis();
+  EXPECT_LT(start, 1000UL);
+
+  unsigned long previous = start;
+  for (int i = 0; i < 1000; i++)
+  {
+    unsigned long now = adapter.tMillis();
+    EXPECT_LE(previous, now);
+    previous = now;
+  }
+
+  sleepMillis(50);
+  unsigned long elapsed = adapter.tMillis() - start;
+  EXPECT_GE(elapsed + resolutionMillis, 50UL);
+  EXPECT_LT(elapsed, 5000UL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Uptime Info Adapter Tests
+
+TEST(UptimeInfoAdapter, monotonic_precise_test)
+{
+  MonotonicUptimeInfoAdapter adapter;
+  EXPECT_LE(adapter.resolutionNanos(), 1000000ULL);
+  expectUptime(adapter, 1);
+}
+
+TEST(UptimeInfoAdapter, monotonic_coarse_test)
+{
+  MonotonicUptimeInfoAdapter adapter(MonotonicUptimeInfoAdapter::COARSE);
+  unsigned long long resolutionNanos = adapter.resolutionNanos();
+  EXPECT_GT(resolutionNanos, 0ULL);
+  expectUptime(adapter, static_cast<unsigned long>(resolutionNanos / 1000000ULL) + 1);
+}
+
+#if defined(__x86_64__)
+TEST(UptimeInfoAdapter, tsc_test)
+{
+  TscUptimeInfoAdapter adapter;
+  if (adapter.isInvariant())
+  {
+    EXPECT_GT(adapter.frequencyHz(), 1000000ULL);
+  }
+  else
+  {
+    // monotonic clock fallback
+    EXPECT_EQ(0ULL, adapter.frequencyHz());
+  }
+  expectUptime(adapter, 1);
+}
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file           : main.cpp
+  * @brief          : Converts a SpinTimerTrace file to the Chrome trace event
+  *                   JSON format (chrome://tracing, https://ui.perfetto.dev)
+  ******************************************************************************
+  */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "SpinTimerTrace.h"
+
+static const char* eventName(uint32_t event)
+{
+    switch (event)
+    {
+        case SpinTimerTrace::EVENT_START:      return "start";
+        case SpinTimerTrace::EVENT_CANCEL:     return "cancel";
+        case SpinTimerTrace::EVENT_EXPIRE:     return "expire";
+        case SpinTimerTrace::EVENT_TICK_BEGIN: return "handleTick";
+        case SpinTimerTrace::EVENT_TICK_END:   return "handleTick";
+        default:                               return "unknown";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if ((argc < 2) || (argc > 3))
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace file> [<json file>]\n";
+        return 1;
+    }
+
+    std::ifstream in(argv[1], std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(SpinTimerTraceHeader))
+    {
+        std::cerr << argv[1] << ": not a trace file\n";
+        return 1;
+    }
+
+    const SpinTimerTraceHeader& header = *reinterpret_cast<const SpinTimerTraceHeader*>(data.data());
+    uint64_t writeIndex = header.writeIndex.load();
+    if ((0 != std::memcmp(header.magic, "SPTTRACE", sizeof(header.magic))) ||
+        (SpinTimerTrace::VERSION != header.version) ||
+        (sizeof(SpinTimerTraceRecord) != header.recordSize) ||
+        (0 == header.capacity) || (0 != (header.capacity & (header.capacity - 1))) ||
+        (data.size() < sizeof(header) + header.capacity * sizeof(SpinTimerTraceRecord)))
+    {
+        std::cerr << argv[1] << ": unsupported trace file\n";
+        return 1;
+    }
+    const SpinTimerTraceRecord* records = reinterpret_cast<const SpinTimerTraceRecord*>(data.data() + sizeof(header));
+
+    std::ofstream file;
+    if (3 == argc)
+    {
+        file.open(argv[2]);
+    }
+    std::ostream& out = (3 == argc) ? file : std::cout;
+
+    // one track per timer, one per context; timestamps in microseconds
+    const double ticksPerMicro = static_cast<double>(header.ticksPerMilli) / 1000.0;
+    std::map<uint64_t, unsigned int> tracks;
+    uint64_t first = (writeIndex > header.capacity) ? writeIndex - header.capacity : 0;
+    bool isFirstEvent = true;
+    unsigned long skipped = 0;
+
+    out << "{\"traceEvents\":[\n";
+    for (uint64_t i = first; i < writeIndex; i++)
+    {
+        const SpinTimerTraceRecord& record = records[i & (header.capacity - 1)];
+        if (static_cast<uint32_t>(i + 1) != record.sequence)
+        {
+            // the process stopped while the record has been written
+            skipped++;
+            continue;
+        }
+
+        std::map<uint64_t, unsigned int>::iterator track = tracks.find(record.object);
+        if (tracks.end() == track)
+        {
+            unsigned int id = static_cast<unsigned int>(tracks.size()) + 1;
+            track = tracks.insert(std::make_pair(record.object, id)).first;
+            bool isContext = (SpinTimerTrace::EVENT_TICK_BEGIN == record.event) || (SpinTimerTrace::EVENT_TICK_END == record.event);
+            char name[64];
+            std::snprintf(name, sizeof(name), "%s 0x%llx", isContext ? "SpinTimerContext" : "SpinTimer",
+                          static_cast<unsigned long long>(record.object));
+            out << (isFirstEvent ? "" : ",\n")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << id << ",\"args\":{\"name\":\"" << name << "\"}}";
+            isFirstEvent = false;
+        }
+
+        const char* phase = "i";
+        if (SpinTimerTrace::EVENT_TICK_BEGIN == record.event)
+        {
+            phase = "B";
+        }
+        else if (SpinTimerTrace::EVENT_TICK_END == record.event)
+        {
+            phase = "E";
+        }
+
+        char timestamp[32];
+        std::snprintf(timestamp, sizeof(timestamp), "%.3f", static_cast<double>(record.timeTicks) / ticksPerMicro);
+        out << ",\n{\"name\":\"" << eventName(record.event) << "\",\"ph\":\"" << phase << "\""
+            << ",\"ts\":" << timestamp << ",\"pid\":1,\"tid\":" << track->second;
+        if ('i' == phase[0])
+        {
+            out << ",\"s\":\"t\",\"args\":{\"value\":" << record.value << "}";
+        }
+        out << "}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    if (0 != skipped)
+    {
+        std::cerr << skipped << " incomplete record(s) skipped\n";
+    }
+    return 0;
+}